@@ -0,0 +1,107 @@
+#include "headers/AllocationCounter.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<std::uint64_t> allocationCount{0};
+    std::atomic<std::uint64_t> allocatedBytes{0};
+    thread_local std::uint64_t threadAllocationCount = 0;
+}
+
+#ifdef HEXXAGON_COUNT_ALLOCATIONS
+
+namespace {
+    void *countedAllocation(std::size_t size, std::size_t alignment) {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        threadAllocationCount++;
+
+        if (size == 0) size = 1;
+        void *pointer = alignment > alignof(std::max_align_t)
+                        ? std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment)
+                        : std::malloc(size);
+        if (!pointer) throw std::bad_alloc();
+        return pointer;
+    }
+}
+
+//https://en.cppreference.com/w/cpp/memory/new/operator_new#Global_replacements
+void *operator new(std::size_t size) {
+    return countedAllocation(size, alignof(std::max_align_t));
+}
+
+void *operator new[](std::size_t size) {
+    return countedAllocation(size, alignof(std::max_align_t));
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+    return countedAllocation(size, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+    return countedAllocation(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept {
+    std::free(pointer);
+}
+
+bool isAllocationCountingEnabled() {
+    return true;
+}
+
+#else
+
+bool isAllocationCountingEnabled() {
+    return false;
+}
+
+#endif
+
+std::uint64_t getAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+std::uint64_t getAllocatedBytes() {
+    return allocatedBytes.load(std::memory_order_relaxed);
+}
+
+std::uint64_t getThreadAllocationCount() {
+    return threadAllocationCount;
+}
+
+AllocationScope::AllocationScope() : startCount(getThreadAllocationCount()) {}
+
+std::uint64_t AllocationScope::getAllocations() const {
+    return getThreadAllocationCount() - startCount;
+}
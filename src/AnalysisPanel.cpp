@@ -0,0 +1,53 @@
+#include "headers/AnalysisPanel.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+
+namespace {
+    //MOVES AFTER THE FIRST ONE, MORE DO NOT FIT NEXT TO THE BOARD
+    constexpr int SHOWN_PV_MOVES = 4;
+
+    //IN PIECES FOR THE SIDE TO MOVE, THE SAME SIGN CONVENTION AS THE ENGINE PROTOCOL
+    std::string formatScore(int score) {
+        if (isWinScore(score)) {
+            int moves = (WIN_SCORE - (score > 0 ? score : -score) + 1) / 2;
+            return fmt::format("{} {}", score > 0 ? "win" : "loss", moves);
+        }
+        return fmt::format("{:+.1f}", static_cast<double>(score) / MATERIAL_WEIGHT);
+    }
+}
+
+AnalysisPanel::AnalysisPanel(sf::RenderWindow &window) : window(window) {
+    if (!font.loadFromFile("../fonts/Silkscreen-Regular.ttf")) {
+        throw std::runtime_error("Unable to load the font.");
+    }
+
+    text.setFont(font);
+    text.setCharacterSize(14);
+    text.setFillColor(sf::Color::White);
+    text.setPosition(20, 340);
+}
+
+void AnalysisPanel::draw() {
+    window.draw(text);
+}
+
+void AnalysisPanel::reset(Position const &position) {
+    text.setString(isTerminal(position) ? "Analysis\nGame over" : "Analysis\nThinking...");
+}
+
+void AnalysisPanel::update(AnalysisSnapshot const &snapshot) {
+    auto const &result = snapshot.result;
+    std::string content = fmt::format("Analysis depth {}\n{:.0f}k nps\n", result.depth,
+                                      snapshot.nodesPerSecond / 1000);
+    for (int i = 0; i < result.lineCount; i++) {
+        auto const &line = result.lines[i];
+        auto const &moves = line.principalVariation.moves;
+        content += fmt::format("{} {:<5}{:>8}\n ", i + 1, moves[0].toString(), formatScore(line.score));
+        int length = std::min(line.principalVariation.length, SHOWN_PV_MOVES + 1);
+        for (int ply = 1; ply < length; ply++) {
+            content += ' ' + moves[ply].toString();
+        }
+        content += '\n';
+    }
+    text.setString(content);
+}
@@ -0,0 +1,72 @@
+#include "headers/Analyzer.hpp"
+#include <algorithm>
+
+Analyzer::Analyzer(TaskScheduler &scheduler, std::size_t hashMegabytes, int lineCount)
+        : scheduler(scheduler), search(hashMegabytes), lineCount(std::clamp(lineCount, 1, MAX_MULTI_PV)) {
+    //NOTHING TO CANCEL YET
+    token.cancel();
+}
+
+Analyzer::~Analyzer() {
+    stop();
+    scheduler.wait();
+}
+
+void Analyzer::analyze(Position const &position) {
+    stop();
+    {
+        //A RESTART ON THE POSITION SHOWN LAST PUBLISHES FROM DEPTH 1 AGAIN
+        std::lock_guard lock(snapshotMutex);
+        published.result.depth = 0;
+    }
+    token = CancellationToken();
+    submitSlice(position, token, 0);
+}
+
+void Analyzer::stop() {
+    token.cancel();
+}
+
+bool Analyzer::poll(AnalysisSnapshot &snapshot) {
+    std::unique_lock lock(snapshotMutex, std::try_to_lock);
+    if (!lock.owns_lock() || published.version == snapshot.version) return false;
+
+    snapshot = published;
+    return true;
+}
+
+void Analyzer::submitSlice(Position const &position, CancellationToken const &sliceToken, std::uint64_t nodes) {
+    scheduler.submit([this, position, sliceToken, nodes] {
+        runSlice(position, sliceToken, nodes);
+    }, TaskPriority::BACKGROUND, sliceToken);
+}
+
+void Analyzer::runSlice(Position const &position, CancellationToken const &sliceToken, std::uint64_t nodes) {
+    SearchResult result;
+    {
+        std::lock_guard lock(searchMutex);
+        if (sliceToken.isCancelled()) return;
+
+        search.setIterationCallback([this, &position, nodes](SearchResult const &result,
+                                                             SearchStatistics const &statistics) {
+            std::lock_guard lock(snapshotMutex);
+            //A NEW SLICE REPEATS THE SHALLOW ITERATIONS OUT OF THE TABLE, THE PANEL KEEPS THE DEEPER LINES
+            if (published.position.hash() == position.hash() && result.depth < published.result.depth) return;
+            published.version++;
+            published.position = position;
+            published.result = result;
+            published.nodes = nodes + statistics.nodes;
+            published.nodesPerSecond = statistics.getNodesPerSecond();
+        });
+        SearchLimits limits;
+        limits.multiPv = lineCount;
+        limits.milliseconds = ANALYSIS_SLICE_MILLISECONDS;
+        limits.stopSignal = sliceToken.getFlag();
+        result = search.run(position, limits);
+        nodes += search.getStatistics().nodes;
+    }
+
+    if (result.depth < MAX_PLY - 1) {
+        submitSlice(position, sliceToken, nodes);
+    }
+}
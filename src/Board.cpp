@@ -1,33 +1,59 @@
 #include "headers/Board.hpp"
-
-Board::Board(int rows, int cols, float hexSize, sf::RenderWindow &window) : rows(rows), cols(cols), hexSize(hexSize),
-                                                                            window(window),
-                                                                            playerACounter(window, Player::PLAYER_A),
-                                                                            playerBCounter(window, Player::PLAYER_B) {}
+#include <bit>
+
+Board::Board(int rows, int cols, float hexSize, sf::RenderWindow &window, std::filesystem::path saveDirectory)
+        : rows(rows), cols(cols), hexSize(hexSize), window(window), saveDirectory(std::move(saveDirectory)),
+          playerACounter(window, Player::PLAYER_A), playerBCounter(window, Player::PLAYER_B),
+          clock(CLOCK_BASE_MILLISECONDS, CLOCK_INCREMENT_MILLISECONDS), threatsVisible(false), hoveredCell(-1),
+          finished(false), shownAnimatedCells(0) {
+    hexagons.reserve(CELL_COUNT);
+}
 
 void Board::start() {
-    hexagons.clear();
-    initializeHexagons();
+    //GEOMETRY IS BUILT ONCE PER WINDOW SIZE, A NEW GAME ONLY RESETS OWNERS AND STATES
+    if (hexagons.empty() || geometrySize != window.getSize()) {
+        initializeHexagons();
+    }
+
+    stopAnimations();
+    Position startPosition;
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        hexagons[cell].setOwner(startPosition.getOwner(cell));
+    }
+    resetStates();
     calculatePoints();
     currentPlayer = Player::PLAYER_A;
+    finished = false;
+    clock.reset();
+    clock.start(currentPlayer);
+    updateThreats();
 }
 
 void Board::draw() {
-    for (auto &col: hexagons) {
-        for (auto &hexagon: col) {
-            hexagon.draw();
+    draw(window);
+}
+
+void Board::draw(sf::RenderTarget &target) {
+    for (auto &hexagon: hexagons) {
+        hexagon.draw(target);
+    }
+    for (Bitboard cells = shownAnimatedCells; cells; cells &= cells - 1) {
+        hexagons[std::countr_zero(cells)].drawPiece(target);
+    }
+    if (threatsVisible) {
+        int source = getSelectedCell();
+        if (source < 0 && hoveredCell >= 0 && hexagons[hoveredCell].getOwner() == currentPlayer) {
+            source = hoveredCell;
         }
+        threatOverlay.draw(target, threatMap, hexagons, currentPlayer, source);
     }
-    playerACounter.draw();
-    playerBCounter.draw();
+    playerACounter.draw(target);
+    playerBCounter.draw(target);
 }
 
-void Board::save() {
-    std::filesystem::path folderPath = "../saved";
-
-    if (!std::filesystem::exists(folderPath)) {
-        std::filesystem::create_directory(folderPath);
-    }
+std::string Board::save(TaskScheduler &scheduler) {
+    //THE BOARD AND THE FILE NAME ARE TAKEN HERE, ONLY THE FILE WRITE RUNS IN THE BACKGROUND
+    std::string content = getPosition().toString();
 
     //https://stackoverflow.com/questions/16357999/current-date-and-time-as-string
     auto now = std::time(nullptr);
@@ -35,39 +61,47 @@ void Board::save() {
 
     std::stringstream ss;
     ss << std::put_time(&dateTime, "%d-%m-%Y_%H-%M-%S");
-    auto dateString = ss.str();
+    auto fileName = "Hexxagon_" + ss.str();
 
-    auto fileName = "../saved/Hexxagon_" + dateString;
+    {
+        std::lock_guard<std::mutex> lock(saveMutex);
+        pendingSaves.emplace_back(fileName, content);
+    }
+    scheduler.submit([this] {
+        flushSaves();
+    });
+    return fileName;
+}
 
-    std::fstream file(fileName, std::ios::out);
+void Board::flushSaves() {
+    std::lock_guard<std::mutex> lock(saveMutex);
+    for (auto const &[fileName, content]: pendingSaves) {
+        if (!std::filesystem::exists(saveDirectory)) {
+            std::filesystem::create_directory(saveDirectory);
+        }
 
-    if (file.is_open()) {
-        file << static_cast<int>(currentPlayer);
-        for (int i = 0; i < hexagons.size(); i++) {
-            for (int j = 0; j < hexagons[i].size(); j++) {
-                file << static_cast<int>(hexagons[i][j].getOwner());
-            }
+        std::fstream file(saveDirectory / fileName, std::ios::out);
+
+        if (file.is_open()) {
+            file << content;
         }
     }
+    pendingSaves.clear();
 }
 
 void Board::load(std::string const &fileName) {
     start();
 
-    std::fstream file("../saved/" + fileName);
+    std::fstream file(saveDirectory / fileName);
 
     if (file.is_open()) {
         std::string line;
         if (std::getline(file, line)) {
-            if (line.size() == 62) {
+            if (line.size() == SAVE_STRING_LENGTH) {
                 currentPlayer = static_cast<Player>(static_cast<int>(line[0] - '0'));
 
-                int index = 1;
-                for (int i = 0; i < hexagons.size(); i++) {
-                    for (int j = 0; j < hexagons[i].size(); j++) {
-                        hexagons[i][j].setOwner(static_cast<Player>(static_cast<int>(line[index] - '0')));
-                        index++;
-                    }
+                for (int cell = 0; cell < CELL_COUNT; cell++) {
+                    hexagons[cell].setOwner(static_cast<Player>(static_cast<int>(line[cell + 1] - '0')));
                 }
             } else {
                 throw std::runtime_error("Incorrect file content.");
@@ -77,88 +111,168 @@ void Board::load(std::string const &fileName) {
         }
     }
     calculatePoints();
+    //SAVE FILES HAVE NO CLOCKS, A LOADED GAME STARTS WITH FULL TIME FOR BOTH
+    clock.start(currentPlayer);
+    updateThreats();
 }
 
 void Board::onMouseClick(float mouseX, float mouseY) {
-    for (int i = 0; i < hexagons.size(); i++) {
-        for (int j = 0; j < hexagons[i].size(); j++) {
-            if (hexagons[i][j].containsCoordinates(mouseX, mouseY)) {
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        auto &hexagon = hexagons[cell];
+        if (hexagon.containsCoordinates(mouseX, mouseY)) {
 
-                if (hexagons[i][j].getState() == HexagonState::DEFAULT ||
-                    hexagons[i][j].getState() == HexagonState::SELECTED) {
-                    resetStates();
-                }
+            if (hexagon.getState() == HexagonState::DEFAULT ||
+                hexagon.getState() == HexagonState::SELECTED) {
+                resetStates();
+            }
 
-                if (hexagons[i][j].getOwner() == currentPlayer) {
-                    hexagons[i][j].setState(HexagonState::SELECTED);
+            if (hexagon.getOwner() == currentPlayer) {
+                hexagon.setState(HexagonState::SELECTED);
 
-                    //GREEN FIELDS
-                    setAdjacentHexagons(i, j, AdjacentHexagonsMode::CLONE_OPTIONS_VIEW_MODE);
+                //GREEN FIELDS
+                setAdjacentHexagons(cell, AdjacentHexagonsMode::CLONE_OPTIONS_VIEW_MODE);
 
-                    //YELLOW FIELDS
-                    setHexagonJumpOptions();
+                //YELLOW FIELDS
+                setHexagonJumpOptions();
 
-                    return;
-                }
+                return;
+            }
 
-                if (hexagons[i][j].getState() == HexagonState::CLONE_OPTION) {
-                    hexagons[i][j].setOwner(getSelectedHexagon().getOwner());
-                    setAdjacentHexagons(i, j, AdjacentHexagonsMode::TAKE_OVER_MODE);
+            if (hexagon.getState() == HexagonState::CLONE_OPTION) {
+                Position before = getPosition();
+                int source = getSelectedCell();
+                hexagon.setOwner(getSelectedHexagon().getOwner());
+                setAdjacentHexagons(cell, AdjacentHexagonsMode::TAKE_OVER_MODE);
 
-                    prepareForNextMove();
-                    return;
-                }
+                prepareForNextMove();
+                animator.start(before, getPosition(), source);
+                return;
+            }
 
-                if (hexagons[i][j].getState() == HexagonState::JUMP_OPTION) {
-                    Hexagon &selectedHexagon = getSelectedHexagon();
+            if (hexagon.getState() == HexagonState::JUMP_OPTION) {
+                Position before = getPosition();
+                Hexagon &selectedHexagon = getSelectedHexagon();
 
-                    hexagons[i][j].setOwner(selectedHexagon.getOwner());
-                    selectedHexagon.setOwner(Player::NO_PLAYER);
-                    setAdjacentHexagons(i, j, AdjacentHexagonsMode::TAKE_OVER_MODE);
+                hexagon.setOwner(selectedHexagon.getOwner());
+                selectedHexagon.setOwner(Player::NO_PLAYER);
+                setAdjacentHexagons(cell, AdjacentHexagonsMode::TAKE_OVER_MODE);
 
-                    prepareForNextMove();
-                    return;
-                }
+                prepareForNextMove();
+                animator.start(before, getPosition());
+                return;
             }
         }
     }
 }
 
-void Board::initializeHexagons() {
-    int hexagonInitialY = floor(rows / 2) * hexSize * sqrt(3);
-    hexagons.resize(cols);
+void Board::onMouseMove(float mouseX, float mouseY) {
+    hoveredCell = -1;
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        if (hexagons[cell].containsCoordinates(mouseX, mouseY)) {
+            hoveredCell = cell;
+            return;
+        }
+    }
+}
 
-    for (int i = 0; i <= ceil(cols / 2); i++) {
-        for (int j = 0; j < rows - i; j++) {
-            float x = window.getSize().x / 2 - i * 1.5 * hexSize;
-            float y = window.getSize().y / 2 + hexagonInitialY - i * hexSize * sqrt(3) / 2 - j * hexSize * sqrt(3);
+void Board::toggleThreats() {
+    threatsVisible = !threatsVisible;
+}
+
+void Board::step() {
+    animator.step();
+}
 
-            hexagons[ceil(cols / 2) - i].emplace_back(x, y, hexSize, window);
+void Board::interpolate(double alpha) {
+    Bitboard animated = animator.getAnimatedCells();
+    for (Bitboard cells = shownAnimatedCells & ~animated; cells; cells &= cells - 1) {
+        hexagons[std::countr_zero(cells)].stopAnimation();
+    }
+    for (Bitboard cells = animated; cells; cells &= cells - 1) {
+        int cell = std::countr_zero(cells);
+        auto frame = animator.getFrame(cell, alpha);
+        sf::Vector2f center = hexagons[cell].getCenter();
+        if (frame.origin >= 0) {
+            center += (hexagons[frame.origin].getCenter() - center) * (1 - frame.travel);
         }
+        hexagons[cell].animatePiece(frame.from, frame.to, frame.blend, frame.scale, center);
     }
-    for (int i = 0; i < floor(cols / 2); i++) {
-        for (int j = 0; j < rows - 1 - i; j++) {
-            float x = window.getSize().x / 2 + (i + 1) * 1.5 * hexSize;
-            float y = window.getSize().y / 2 + hexagonInitialY - hexSize * sqrt(3) / 2 - i * hexSize * sqrt(3) / 2 -
-                      j * hexSize * sqrt(3);
+    shownAnimatedCells = animated;
+}
 
-            hexagons[ceil(cols / 2) + 1 + i].emplace_back(x, y, hexSize, window);
-        }
+void Board::updateClock() {
+    Player flagged = clock.getFlaggedPlayer();
+    if (flagged != Player::NO_PLAYER && !finished) {
+        std::cout << (flagged == Player::PLAYER_A ? "PLAYER B WINS ON TIME!" : "PLAYER A WINS ON TIME!");
+        finished = true;
+        clock.stop();
+        window.close();
     }
 
-    //ROWS AND COLUMNS SORT + SETTING START POSITION FOR PLAYERS
-    for (int i = 0; i < hexagons.size(); i++) {
-        std::reverse(hexagons[i].begin(), hexagons[i].end());
+    playerACounter.updateClock(clock.getRemainingMilliseconds(Player::PLAYER_A),
+                               clock.getRunningPlayer() == Player::PLAYER_A);
+    playerBCounter.updateClock(clock.getRemainingMilliseconds(Player::PLAYER_B),
+                               clock.getRunningPlayer() == Player::PLAYER_B);
+}
+
+void Board::pauseClock() {
+    clock.stop();
+}
 
-        for (int j = 0; j < hexagons[i].size(); j++) {
-            if (j == 0 && (i == 0 || i == hexagons.size() - 1)
-                || i == hexagons.size() / 2 && j == hexagons[i].size() - 1)
-                hexagons[i][j].setOwner(Player::PLAYER_A);
+void Board::resumeClock() {
+    if (!finished && clock.getRunningPlayer() == Player::NO_PLAYER) {
+        clock.start(currentPlayer);
+    }
+}
 
-            if (j == hexagons[i].size() - 1 && (i == 0 || i == hexagons.size() - 1)
-                || i == hexagons.size() / 2 && j == 0)
-                hexagons[i][j].setOwner(Player::PLAYER_B);
-        }
+Position Board::getPosition() {
+    auto position = Position::fromBitboards(0, 0, currentPlayer);
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        position.setOwner(cell, hexagons[cell].getOwner());
+    }
+    return position;
+}
+
+int Board::getPoints(Player player) const {
+    return player == Player::PLAYER_A ? playerAPoints : playerBPoints;
+}
+
+bool Board::isFinished() const {
+    return finished;
+}
+
+sf::Vector2f Board::getCellCenter(int cell) const {
+    return hexagons[cell].getCenter();
+}
+
+void Board::showHint(Move move) {
+    if (move.isNull()) {
+        return;
+    }
+
+    //SAME VIEW AS CLICKING THE PIECE TO MOVE, WITH THE SUGGESTED TARGET OUTLINED
+    resetStates();
+    hexagons[move.from].setState(HexagonState::SELECTED);
+    setAdjacentHexagons(move.from, AdjacentHexagonsMode::CLONE_OPTIONS_VIEW_MODE);
+    setHexagonJumpOptions();
+    hexagons[move.to].setHighlighted(true);
+}
+
+void Board::initializeHexagons() {
+    float hexagonInitialY = floor(rows / 2) * hexSize * sqrt(3);
+    geometrySize = window.getSize();
+    hexagons.clear();
+
+    //HEXAGONS ARE STORED IN CELL ORDER, SO THE CELL ID FROM Position IS ALSO THE INDEX HERE
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        int column = CELLS.column[cell] - cols / 2;
+        int distanceFromCenter = std::abs(column);
+        int rowsBelow = CELLS.columnSize[CELLS.column[cell]] - 1 - CELLS.row[cell];
+
+        float x = geometrySize.x / 2 + column * 1.5 * hexSize;
+        float y = geometrySize.y / 2 + hexagonInitialY - distanceFromCenter * hexSize * sqrt(3) / 2 -
+                  rowsBelow * hexSize * sqrt(3);
+        hexagons.emplace_back(x, y, hexSize);
     }
 }
 
@@ -170,41 +284,29 @@ void Board::changePlayer() {
     }
 }
 
-Hexagon &Board::getHexagon(int column, int row) {
-    for (int i = 0; i < hexagons.size(); i++) {
-        for (int j = 0; j < hexagons[i].size(); j++) {
-            if (i == column && j == row) {
-                return hexagons[i][j];
-            }
-        }
-    }
-}
-
 void Board::prepareForNextMove() {
+    clock.press();
     calculatePoints();
     checkForWinner();
+    if (finished) {
+        clock.stop();
+    }
     resetStates();
     changePlayer();
+    updateThreats();
 }
 
 Hexagon &Board::getSelectedHexagon() {
-    for (auto &col: hexagons) {
-        for (auto &hexagon: col) {
-            if (hexagon.getState() == HexagonState::SELECTED) {
-                return hexagon;
-            }
-        }
-    }
+    return hexagons[getSelectedCell()];
 }
 
-std::pair<int, int> Board::getSelectedHexagonBoardPosition() {
-    for (int i = 0; i < hexagons.size(); i++) {
-        for (int j = 0; j < hexagons[i].size(); j++) {
-            if (hexagons[i][j].getState() == HexagonState::SELECTED) {
-                return std::make_pair(i, j);
-            }
+int Board::getSelectedCell() {
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        if (hexagons[cell].getState() == HexagonState::SELECTED) {
+            return cell;
         }
     }
+    return -1;
 }
 
 void Board::calculatePoints() {
@@ -212,17 +314,15 @@ void Board::calculatePoints() {
     playerBPoints = 0;
     emptyFields = 0;
 
-    for (auto &col: hexagons) {
-        for (auto &hexagon: col) {
-            if (hexagon.getOwner() == Player::PLAYER_A) {
-                playerAPoints++;
-            }
-            if (hexagon.getOwner() == Player::PLAYER_B) {
-                playerBPoints++;
-            }
-            if (hexagon.getOwner() == Player::NO_PLAYER) {
-                emptyFields++;
-            }
+    for (auto &hexagon: hexagons) {
+        if (hexagon.getOwner() == Player::PLAYER_A) {
+            playerAPoints++;
+        }
+        if (hexagon.getOwner() == Player::PLAYER_B) {
+            playerBPoints++;
+        }
+        if (hexagon.getOwner() == Player::NO_PLAYER) {
+            emptyFields++;
         }
     }
 
@@ -230,244 +330,65 @@ void Board::calculatePoints() {
     playerBCounter.updatePoints(playerBPoints);
 }
 
+void Board::updateThreats() {
+    threatMap.update(getPosition());
+}
+
 void Board::checkForWinner() {
     if (emptyFields == 0) {
         if (playerAPoints > playerBPoints) {
             std::cout << "PLAYER A WINS!";
+            finished = true;
             window.close();
         }
         if (playerBPoints > playerAPoints) {
             std::cout << "PLAYER B WINS!";
+            finished = true;
             window.close();
         }
         if (playerBPoints == playerAPoints) {
             std::cout << "DRAW!";
+            finished = true;
             window.close();
         }
     }
     if (playerBPoints == 0) {
         std::cout << "PLAYER A WINS!";
+        finished = true;
         window.close();
     }
     if (playerAPoints == 0) {
         std::cout << "PLAYER B WINS!";
+        finished = true;
         window.close();
     }
 }
 
 void Board::resetStates() {
-    for (auto &col: hexagons) {
-        for (auto &hexagon: col) {
-            hexagon.setState(HexagonState::DEFAULT);
-        }
+    for (auto &hexagon: hexagons) {
+        hexagon.setState(HexagonState::DEFAULT);
+        hexagon.setHighlighted(false);
     }
 }
 
-void Board::setAdjacentHexagons(int column, int row, AdjacentHexagonsMode mode) {
-    //TOP HEXAGON
-    if (row > 0) {
-        auto &hexagon = getHexagon(column, row - 1);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    //RIGHT TOP HEXAGON
-    if (column < (hexagons.size() / 2)) {
-        auto &hexagon = getHexagon(column + 1, row);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    if (column >= (hexagons.size() / 2) && row > 0 && column < hexagons.size() - 1) {
-        auto &hexagon = getHexagon(column + 1, row - 1);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    //RIGHT BOTTOM HEXAGON
-    if (column < (hexagons.size() / 2)) {
-        auto &hexagon = getHexagon(column + 1, row + 1);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    if (column >= (hexagons.size() / 2) && row < hexagons[column].size() - 1 && column < hexagons.size() - 1) {
-        auto &hexagon = getHexagon(column + 1, row);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    //BOTTOM HEXAGON
-    if (row < hexagons[column].size() - 1) {
-        auto &hexagon = getHexagon(column, row + 1);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    //LEFT BOTTOM HEXAGON
-    if (column > (hexagons.size() / 2)) {
-        auto &hexagon = getHexagon(column - 1, row + 1);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    if (column <= (hexagons.size() / 2) && row < hexagons[column].size() - 1 && column > 0) {
-        auto &hexagon = getHexagon(column - 1, row);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
-    }
-    //LEFT TOP HEXAGON
-    if (column > (hexagons.size() / 2)) {
-        auto &hexagon = getHexagon(column - 1, row);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
+void Board::setAdjacentHexagons(int cell, AdjacentHexagonsMode mode) {
+    for (Bitboard cells = CELLS.neighbours[cell]; cells; cells &= cells - 1) {
+        hexagons[std::countr_zero(cells)].applyAdjacentHexagonsMode(mode, currentPlayer);
     }
-    if (column <= (hexagons.size() / 2) && row > 0 && column > 0) {
-        auto &hexagon = getHexagon(column - 1, row - 1);
-        hexagon.applyAdjacentHexagonsMode(mode, currentPlayer);
+}
+
+void Board::stopAnimations() {
+    animator.clear();
+    for (Bitboard cells = shownAnimatedCells; cells; cells &= cells - 1) {
+        hexagons[std::countr_zero(cells)].stopAnimation();
     }
+    shownAnimatedCells = 0;
 }
 
 void Board::setHexagonJumpOptions() {
-    std::pair<int, int> hexagonPosition = getSelectedHexagonBoardPosition();
-    int column = hexagonPosition.first;
-    int row = hexagonPosition.second;
-
-    //TOP HEXAGON
-    if (row > 1) {
-        auto &hexagon = getHexagon(column, row - 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //TOP RIGHT FIRST HEXAGON
-    if (column < (hexagons.size() / 2) && row > 0) {
-        auto &hexagon = getHexagon(column + 1, row - 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column >= (hexagons.size() / 2) && row > 1 && column < hexagons.size() - 1) {
-        auto &hexagon = getHexagon(column + 1, row - 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //TOP RIGHT SECOND HEXAGON
-    if (column < (hexagons.size() / 2) - 1) {
-        auto &hexagon = getHexagon(column + 2, row);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column == (hexagons.size() / 2) - 1 && row > 0) {
-        auto &hexagon = getHexagon(column + 2, row - 1);
+    for (Bitboard cells = CELLS.jumps[getSelectedCell()]; cells; cells &= cells - 1) {
+        auto &hexagon = hexagons[std::countr_zero(cells)];
         if (hexagon.getOwner() == Player::NO_PLAYER)
             hexagon.setState(HexagonState::JUMP_OPTION);
     }
-    if (column >= (hexagons.size() / 2) && row > 1 && column < hexagons.size() - 2) {
-        auto &hexagon = getHexagon(column + 2, row - 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //RIGHT HEXAGON
-    if (column < (hexagons.size() / 2) - 1) {
-        auto &hexagon = getHexagon(column + 2, row + 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column == (hexagons.size() / 2) - 1) {
-        auto &hexagon = getHexagon(column + 2, row);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column >= (hexagons.size() / 2) && row > 0 && row < hexagons[column].size() - 1 &&
-        column < hexagons.size() - 2) {
-        auto &hexagon = getHexagon(column + 2, row - 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //BOTTOM RIGHT FIRST HEXAGON
-    if (column < (hexagons.size() / 2) - 1) {
-        auto &hexagon = getHexagon(column + 2, row + 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column == (hexagons.size() / 2) - 1 && row < hexagons[column].size() - 1) {
-        auto &hexagon = getHexagon(column + 2, row + 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column > (hexagons.size() / 2) - 1 && row < hexagons[column].size() - 2 && column < hexagons.size() - 2) {
-        auto &hexagon = getHexagon(column + 2, row);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //BOTTOM RIGHT SECOND HEXAGON
-    if (column < (hexagons.size() / 2) && row < hexagons[column].size() - 1) {
-        auto &hexagon = getHexagon(column + 1, row + 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column >= (hexagons.size() / 2) && row < hexagons[column].size() - 2 && column < hexagons.size() - 1) {
-        auto &hexagon = getHexagon(column + 1, row + 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //BOTTOM HEXAGON
-    if (row < hexagons[column].size() - 2) {
-        auto &hexagon = getHexagon(column, row + 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //BOTTOM LEFT FIRST HEXAGON
-    if (column > (hexagons.size() / 2) && row < hexagons[column].size() - 1) {
-        auto &hexagon = getHexagon(column - 1, row + 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column <= (hexagons.size() / 2) && row < hexagons[column].size() - 2 && column > 0) {
-        auto &hexagon = getHexagon(column - 1, row + 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //BOTTOM LEFT SECOND HEXAGON
-    if (column > (hexagons.size() / 2) + 1) {
-        auto &hexagon = getHexagon(column - 2, row + 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column == (hexagons.size() / 2) + 1 && row < hexagons[column].size() - 1) {
-        auto &hexagon = getHexagon(column - 2, row + 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column <= (hexagons.size() / 2) && row < hexagons[column].size() - 2 && column > 1) {
-        auto &hexagon = getHexagon(column - 2, row);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //LEFT HEXAGON
-    if (column > (hexagons.size() / 2) + 1) {
-        auto &hexagon = getHexagon(column - 2, row + 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column == (hexagons.size() / 2) + 1) {
-        auto &hexagon = getHexagon(column - 2, row);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column <= (hexagons.size() / 2) && row > 0 && row < hexagons[column].size() - 1 && column >= 2) {
-        auto &hexagon = getHexagon(column - 2, row - 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //TOP LEFT FIRST HEXAGON
-    if (column > (hexagons.size() / 2) + 1) {
-        auto &hexagon = getHexagon(column - 2, row);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column == (hexagons.size() / 2) + 1 && row > 0) {
-        auto &hexagon = getHexagon(column - 2, row - 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column <= (hexagons.size() / 2) && row > 1 && column > 1) {
-        auto &hexagon = getHexagon(column - 2, row - 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    //TOP LEFT SECOND HEXAGON
-    if (column > (hexagons.size() / 2) && row > 0) {
-        auto &hexagon = getHexagon(column - 1, row - 1);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-    if (column <= (hexagons.size() / 2) && row > 1 && column > 0) {
-        auto &hexagon = getHexagon(column - 1, row - 2);
-        if (hexagon.getOwner() == Player::NO_PLAYER)
-            hexagon.setState(HexagonState::JUMP_OPTION);
-    }
-}
\ No newline at end of file
+}
@@ -0,0 +1,117 @@
+#include "headers/CellAnimator.hpp"
+#include "headers/FixedTimestep.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <numbers>
+
+namespace {
+    constexpr int stepsFor(double seconds) {
+        return static_cast<int>(seconds * SIMULATION_STEPS_PER_SECOND + 0.5);
+    }
+
+    constexpr int MOVE_STEPS = stepsFor(0.2);
+    constexpr int VACATE_STEPS = stepsFor(0.1);
+    //THE FLIPS START SHORTLY BEFORE THE MOVED PIECE LANDS
+    constexpr int FLIP_DELAY_STEPS = stepsFor(0.15);
+    constexpr int FLIP_STEPS = stepsFor(0.25);
+    constexpr float CLONE_START_SCALE = 0.4f;
+    //A FLIPPING PIECE IS SEEN EDGE-ON HALFWAY, NEVER QUITE GONE
+    constexpr float FLIP_MINIMUM_SCALE = 0.1f;
+
+    float smoothStep(float t) {
+        return t * t * (3 - 2 * t);
+    }
+}
+
+CellAnimator::CellAnimator() : animations(), animatedCells(0) {}
+
+bool CellAnimator::start(Position const &before, Position const &after, int origin) {
+    clear();
+
+    Player mover = before.getSideToMove();
+    Player opponent = opponentOf(mover);
+    Bitboard moverBefore = before.getPieces(mover), moverAfter = after.getPieces(mover);
+    Bitboard opponentBefore = before.getPieces(opponent), opponentAfter = after.getPieces(opponent);
+
+    Bitboard placed = moverAfter & before.getEmpty();
+    Bitboard vacated = moverBefore & after.getEmpty();
+    Bitboard flipped = opponentBefore & moverAfter;
+    //ANYTHING ELSE THAN ONE CLONE OR JUMP AND ITS CAPTURES IS NOT ANIMATED
+    if (std::popcount(placed) != 1 || std::popcount(vacated) > 1 ||
+        moverAfter != ((moverBefore | placed | flipped) & ~vacated) || opponentAfter != (opponentBefore & ~flipped)) {
+        return false;
+    }
+
+    int target = std::countr_zero(placed);
+    if (vacated) {
+        int source = std::countr_zero(vacated);
+        add(target, CellAnimationType::JUMP, Player::NO_PLAYER, mover, source, 0, MOVE_STEPS);
+        add(source, CellAnimationType::VACATE, mover, Player::NO_PLAYER, -1, 0, VACATE_STEPS);
+    } else {
+        Bitboard parents = CELLS.neighbours[target] & moverBefore;
+        if (origin < 0 || origin >= CELL_COUNT || !(parents & cellBit(origin))) {
+            origin = parents ? std::countr_zero(parents) : target;
+        }
+        add(target, CellAnimationType::CLONE, Player::NO_PLAYER, mover, origin, 0, MOVE_STEPS);
+    }
+    for (Bitboard cells = flipped; cells; cells &= cells - 1) {
+        add(std::countr_zero(cells), CellAnimationType::FLIP, opponent, mover, -1, FLIP_DELAY_STEPS, FLIP_STEPS);
+    }
+    return true;
+}
+
+void CellAnimator::step(int steps) {
+    for (Bitboard cells = animatedCells; cells; cells &= cells - 1) {
+        int cell = std::countr_zero(cells);
+        auto &animation = animations[cell];
+        animation.elapsed = static_cast<std::int16_t>(std::min(animation.elapsed + steps,
+                                                               animation.delay + animation.duration));
+        if (animation.elapsed == animation.delay + animation.duration) {
+            animatedCells &= ~cellBit(cell);
+        }
+    }
+}
+
+void CellAnimator::clear() {
+    animatedCells = 0;
+}
+
+Bitboard CellAnimator::getAnimatedCells() const {
+    return animatedCells;
+}
+
+PieceFrame CellAnimator::getFrame(int cell, double alpha) const {
+    auto const &animation = animations[cell];
+    auto t = static_cast<float>((animation.elapsed - animation.delay + alpha) / animation.duration);
+    t = smoothStep(std::clamp(t, 0.0f, 1.0f));
+
+    PieceFrame frame{animation.from, animation.to, 1, 1, -1, 1};
+    switch (animation.type) {
+        case CellAnimationType::CLONE:
+            frame.scale = CLONE_START_SCALE + (1 - CLONE_START_SCALE) * t;
+            frame.origin = animation.origin;
+            frame.travel = t;
+            break;
+        case CellAnimationType::JUMP:
+            frame.origin = animation.origin;
+            frame.travel = t;
+            break;
+        case CellAnimationType::VACATE:
+            frame.blend = 0;
+            frame.scale = 1 - t;
+            break;
+        case CellAnimationType::FLIP:
+            frame.blend = t < 0.5f ? 0 : 1;
+            frame.scale = std::max(FLIP_MINIMUM_SCALE, std::abs(std::cos(t * std::numbers::pi_v<float>)));
+            break;
+    }
+    return frame;
+}
+
+void CellAnimator::add(int cell, CellAnimationType type, Player from, Player to, int origin, int delay,
+                       int duration) {
+    animations[cell] = {type, from, to, static_cast<std::int8_t>(origin), static_cast<std::int16_t>(delay),
+                        static_cast<std::int16_t>(duration), 0};
+    animatedCells |= cellBit(cell);
+}
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "headers/Counter.hpp"
+#include "headers/GameClock.hpp"
 
-Counter::Counter(sf::RenderWindow &window, Player player) : window(window) {
+Counter::Counter(sf::RenderWindow &window, Player player) : clockLabel(std::string(CLOCK_LABEL_LENGTH, ' ')),
+                                                            shownPoints(-1), shownClock(-1), shownRunning(false) {
     if (!font.loadFromFile("../fonts/Silkscreen-Regular.ttf")) {
         throw std::runtime_error("Unable to load the font.");
     }
@@ -10,24 +12,62 @@ Counter::Counter(sf::RenderWindow &window, Player player) : window(window) {
     text.setFont(font);
     text.setCharacterSize(30);
 
+    clockText.setFont(font);
+    clockText.setCharacterSize(24);
+    clockText.setFillColor(sf::Color(128, 128, 128));
+
     owningPlayer = player;
     if (player == Player::PLAYER_A) {
+        playerColor = sf::Color::Red;
         text.setPosition(20, 20);
-        text.setFillColor(sf::Color::Red);
+        clockText.setPosition(20, 100);
     }
     if (player == Player::PLAYER_B) {
+        playerColor = sf::Color::Blue;
         text.setPosition(window.getSize().x - 190, 20);
-        text.setFillColor(sf::Color::Blue);
+        clockText.setPosition(window.getSize().x - 190, 100);
+    }
+    text.setFillColor(playerColor);
+
+    std::string playerString = (owningPlayer == Player::PLAYER_A) ? "Player A" : "Player B";
+    for (int points = 0; points <= CELL_COUNT; points++) {
+        labels[points] = playerString + "\n     " + std::to_string(points);
     }
 
     updatePoints(3);
 }
 
-void Counter::draw() {
-    window.draw(text);
+void Counter::draw(sf::RenderTarget &target) {
+    target.draw(text);
+    target.draw(clockText);
 }
 
 void Counter::updatePoints(int points) {
-    std::string playerString = (owningPlayer == Player::PLAYER_A) ? "Player A" : "Player B";
-    text.setString(playerString + "\n     " + std::to_string(points));
+    if (points == shownPoints) {
+        return;
+    }
+    shownPoints = points;
+    text.setString(labels[points]);
+}
+
+void Counter::updateClock(std::int64_t milliseconds, bool running) {
+    //ONLY WHAT IS SHOWN COUNTS: WHOLE SECONDS, TENTHS BELOW TEN SECONDS
+    auto shown = milliseconds < 10000 ? milliseconds / 100 : milliseconds / 1000 * 10;
+    if (running != shownRunning) {
+        shownRunning = running;
+        clockText.setFillColor(running ? playerColor : sf::Color(128, 128, 128));
+    }
+    if (shown == shownClock) {
+        return;
+    }
+    shownClock = shown;
+
+    //PADDED WITH SPACES, WHICH DRAW NOTHING, SO THE LABEL AND THE TEXT'S COPY OF IT NEVER CHANGE LENGTH OR ALLOCATE
+    std::array<char, CLOCK_LABEL_LENGTH> buffer;
+    buffer.fill(' ');
+    GameClock::format(milliseconds, buffer.data(), buffer.size());
+    for (std::size_t i = 0; i < buffer.size(); i++) {
+        clockLabel[i] = static_cast<unsigned char>(buffer[i]);
+    }
+    clockText.setString(clockLabel);
 }
\ No newline at end of file
@@ -0,0 +1,230 @@
+#include "headers/DifferentialHarness.hpp"
+#include "headers/Evaluation.hpp"
+#include <stdexcept>
+
+namespace {
+    //THE BASELINE Board's GEOMETRY BEFORE IT READ CELLS: hexagons[column][row] WITH ROW 0 AT THE TOP, NINE ROWS IN
+    //THE CENTER COLUMN, AND ONE HAND-WRITTEN RULE PER DIRECTION AGAINST hexagons.size() / 2. THE RULES ARE COPIED
+    //VERBATIM SO Position's TABLES ARE CHECKED AGAINST THE ORIGINAL GAME INSTEAD OF AGAINST THEMSELVES.
+    constexpr int LEGACY_ROWS = 9;
+    constexpr int LEGACY_COLUMNS = 9;
+    constexpr int HALF = LEGACY_COLUMNS / 2;
+
+    int legacyColumnSize(int column) {
+        return column <= HALF ? LEGACY_ROWS - (HALF - column) : LEGACY_ROWS - 1 - (column - HALF - 1);
+    }
+
+    //getHexagon FELL OFF ITS END FOR A CELL THAT DOES NOT EXIST, SO A RULE NAMING ONE IS A MISMATCH OF ITS OWN
+    Bitboard legacyBit(int column, int row) {
+        if (column < 0 || column >= LEGACY_COLUMNS || row < 0 || row >= legacyColumnSize(column)) {
+            throw std::runtime_error("baseline rule names the missing hexagon " + std::to_string(column) + ":" +
+                                     std::to_string(row));
+        }
+        int cell = row;
+        for (int i = 0; i < column; i++) cell += legacyColumnSize(i);
+        return cellBit(cell);
+    }
+
+    std::pair<int, int> legacyCoordinates(int cell) {
+        int column = 0;
+        while (cell >= legacyColumnSize(column)) cell -= legacyColumnSize(column++);
+        return {column, cell};
+    }
+
+    //Board::setAdjacentHexagons
+    Bitboard legacyNeighbours(int cell) {
+        auto [column, row] = legacyCoordinates(cell);
+        int size = legacyColumnSize(column);
+        Bitboard cells = 0;
+        //TOP HEXAGON
+        if (row > 0) cells |= legacyBit(column, row - 1);
+        //RIGHT TOP HEXAGON
+        if (column < HALF) cells |= legacyBit(column + 1, row);
+        if (column >= HALF && row > 0 && column < LEGACY_COLUMNS - 1) cells |= legacyBit(column + 1, row - 1);
+        //RIGHT BOTTOM HEXAGON
+        if (column < HALF) cells |= legacyBit(column + 1, row + 1);
+        if (column >= HALF && row < size - 1 && column < LEGACY_COLUMNS - 1) cells |= legacyBit(column + 1, row);
+        //BOTTOM HEXAGON
+        if (row < size - 1) cells |= legacyBit(column, row + 1);
+        //LEFT BOTTOM HEXAGON
+        if (column > HALF) cells |= legacyBit(column - 1, row + 1);
+        if (column <= HALF && row < size - 1 && column > 0) cells |= legacyBit(column - 1, row);
+        //LEFT TOP HEXAGON
+        if (column > HALF) cells |= legacyBit(column - 1, row);
+        if (column <= HALF && row > 0 && column > 0) cells |= legacyBit(column - 1, row - 1);
+        return cells;
+    }
+
+    //Board::setHexagonJumpOptions
+    Bitboard legacyJumps(int cell) {
+        auto [column, row] = legacyCoordinates(cell);
+        int size = legacyColumnSize(column);
+        Bitboard cells = 0;
+        //TOP HEXAGON
+        if (row > 1) cells |= legacyBit(column, row - 2);
+        //TOP RIGHT FIRST HEXAGON
+        if (column < HALF && row > 0) cells |= legacyBit(column + 1, row - 1);
+        if (column >= HALF && row > 1 && column < LEGACY_COLUMNS - 1) cells |= legacyBit(column + 1, row - 2);
+        //TOP RIGHT SECOND HEXAGON
+        if (column < HALF - 1) cells |= legacyBit(column + 2, row);
+        if (column == HALF - 1 && row > 0) cells |= legacyBit(column + 2, row - 1);
+        if (column >= HALF && row > 1 && column < LEGACY_COLUMNS - 2) cells |= legacyBit(column + 2, row - 2);
+        //RIGHT HEXAGON
+        if (column < HALF - 1) cells |= legacyBit(column + 2, row + 1);
+        if (column == HALF - 1) cells |= legacyBit(column + 2, row);
+        if (column >= HALF && row > 0 && row < size - 1 && column < LEGACY_COLUMNS - 2) {
+            cells |= legacyBit(column + 2, row - 1);
+        }
+        //BOTTOM RIGHT FIRST HEXAGON
+        if (column < HALF - 1) cells |= legacyBit(column + 2, row + 2);
+        if (column == HALF - 1 && row < size - 1) cells |= legacyBit(column + 2, row + 1);
+        if (column > HALF - 1 && row < size - 2 && column < LEGACY_COLUMNS - 2) cells |= legacyBit(column + 2, row);
+        //BOTTOM RIGHT SECOND HEXAGON
+        if (column < HALF && row < size - 1) cells |= legacyBit(column + 1, row + 2);
+        if (column >= HALF && row < size - 2 && column < LEGACY_COLUMNS - 1) cells |= legacyBit(column + 1, row + 1);
+        //BOTTOM HEXAGON
+        if (row < size - 2) cells |= legacyBit(column, row + 2);
+        //BOTTOM LEFT FIRST HEXAGON
+        if (column > HALF && row < size - 1) cells |= legacyBit(column - 1, row + 2);
+        if (column <= HALF && row < size - 2 && column > 0) cells |= legacyBit(column - 1, row + 1);
+        //BOTTOM LEFT SECOND HEXAGON
+        if (column > HALF + 1) cells |= legacyBit(column - 2, row + 2);
+        if (column == HALF + 1 && row < size - 1) cells |= legacyBit(column - 2, row + 1);
+        if (column <= HALF && row < size - 2 && column > 1) cells |= legacyBit(column - 2, row);
+        //LEFT HEXAGON
+        if (column > HALF + 1) cells |= legacyBit(column - 2, row + 1);
+        if (column == HALF + 1) cells |= legacyBit(column - 2, row);
+        if (column <= HALF && row > 0 && row < size - 1 && column >= 2) cells |= legacyBit(column - 2, row - 1);
+        //TOP LEFT FIRST HEXAGON
+        if (column > HALF + 1) cells |= legacyBit(column - 2, row);
+        if (column == HALF + 1 && row > 0) cells |= legacyBit(column - 2, row - 1);
+        if (column <= HALF && row > 1 && column > 1) cells |= legacyBit(column - 2, row - 2);
+        //TOP LEFT SECOND HEXAGON
+        if (column > HALF && row > 0) cells |= legacyBit(column - 1, row - 1);
+        if (column <= HALF && row > 1 && column > 0) cells |= legacyBit(column - 1, row - 2);
+        return cells;
+    }
+}
+
+DifferentialHarness::DifferentialHarness(sf::RenderWindow &window) : board(9, 9, 35, window), selected(-1),
+                                                                     clickCount(0), moveCount(0) {
+    startGame();
+}
+
+void DifferentialHarness::startGame() {
+    board.start();
+    position = Position();
+    selected = -1;
+    compare(-1);
+}
+
+void DifferentialHarness::click(int cell) {
+    bool onBoard = cell >= 0 && cell < CELL_COUNT;
+    auto point = onBoard ? board.getCellCenter(cell) : sf::Vector2f(-1000, -1000);
+    board.onMouseClick(point.x, point.y);
+    clickCount++;
+
+    //THE RULES THE LEGACY CLICK HANDLER IS EXPECTED TO FOLLOW
+    if (onBoard && position.getOwner(cell) == position.getSideToMove()) {
+        selected = cell;
+    } else if (onBoard && selected >= 0 && checkBaselineRules(cell)) {
+        position.makeMove({static_cast<std::int8_t>(selected), static_cast<std::int8_t>(cell)});
+        selected = -1;
+        moveCount++;
+    } else if (onBoard) {
+        selected = -1;
+    }
+    compare(cell);
+}
+
+void DifferentialHarness::playMove(Move move) {
+    click(move.from);
+    click(move.to);
+}
+
+void DifferentialHarness::playBytes(std::uint8_t const *data, std::size_t size) {
+    for (std::size_t i = 0; i < size; i++) {
+        if (isGameOver()) startGame();
+
+        if ((data[i] & 0x80) && i + 1 < size) {
+            MoveList moveList;
+            position.generateMoves(moveList);
+            playMove(moveList.moves[data[++i] % moveList.size]);
+        } else {
+            click(data[i] % 64);
+        }
+    }
+}
+
+bool DifferentialHarness::isGameOver() const {
+    return isTerminal(position);
+}
+
+Position const &DifferentialHarness::getPosition() const {
+    return position;
+}
+
+std::uint64_t DifferentialHarness::getClickCount() const {
+    return clickCount;
+}
+
+std::uint64_t DifferentialHarness::getMoveCount() const {
+    return moveCount;
+}
+
+bool DifferentialHarness::checkBaselineRules(int cell) {
+    Move move{static_cast<std::int8_t>(selected), static_cast<std::int8_t>(cell)};
+    Player side = position.getSideToMove();
+    Bitboard own = position.getPieces(side), enemy = position.getPieces(opponentOf(side));
+
+    //THE BASELINE MARKED EMPTY NEIGHBOURS AS CLONE OPTIONS, THEN EMPTY JUMP TARGETS ON TOP OF THEM
+    bool isJump = (legacyJumps(selected) & cellBit(cell)) != 0;
+    bool isClone = !isJump && (legacyNeighbours(selected) & cellBit(cell)) != 0;
+    bool baselineLegal = (isJump || isClone) && (position.getEmpty() & cellBit(cell));
+    if (baselineLegal != position.isLegal(move)) {
+        throw std::runtime_error("baseline rules and Position disagree whether " + std::to_string(selected) + "->" +
+                                 std::to_string(cell) + " is legal in " + position.toString());
+    }
+    if (!baselineLegal) return false;
+
+    //TAKE_OVER_MODE ON THE TARGET'S NEIGHBOURS, AND A JUMP EMPTIES THE SOURCE
+    Bitboard captured = legacyNeighbours(cell) & enemy;
+    own = (own | cellBit(cell) | captured) & ~(isJump ? cellBit(selected) : 0);
+    enemy &= ~captured;
+
+    Position after = position;
+    after.makeMove(move);
+    if (after.getPieces(side) != own || after.getPieces(opponentOf(side)) != enemy) {
+        throw std::runtime_error("baseline rules and Position disagree on the result of " + std::to_string(selected) +
+                                 "->" + std::to_string(cell) + " in " + position.toString() + "\n  Baseline: " +
+                                 Position::fromBitboards(side == Player::PLAYER_A ? own : enemy,
+                                                         side == Player::PLAYER_A ? enemy : own,
+                                                         opponentOf(side)).toString() +
+                                 "\n  Position: " + after.toString());
+    }
+    return true;
+}
+
+void DifferentialHarness::compare(int cell) {
+    auto legacy = board.getPosition();
+    std::string problem;
+    if (!(legacy == position)) {
+        problem = "position";
+    } else if (board.getPoints(Player::PLAYER_A) != position.getPoints(Player::PLAYER_A) ||
+               board.getPoints(Player::PLAYER_B) != position.getPoints(Player::PLAYER_B)) {
+        problem = "points";
+    } else if (board.isFinished() != position.isGameOver()) {
+        problem = "game over";
+    }
+
+    if (!problem.empty()) {
+        throw std::runtime_error("Board and Position disagree on the " + problem + " after click " +
+                                 std::to_string(clickCount) + " on cell " + std::to_string(cell) + "\n  Board:    " +
+                                 legacy.toString() + " " + std::to_string(board.getPoints(Player::PLAYER_A)) + ":" +
+                                 std::to_string(board.getPoints(Player::PLAYER_B)) +
+                                 (board.isFinished() ? " over" : "") + "\n  Position: " + position.toString() + " " +
+                                 std::to_string(position.getPoints(Player::PLAYER_A)) + ":" +
+                                 std::to_string(position.getPoints(Player::PLAYER_B)) +
+                                 (position.isGameOver() ? " over" : ""));
+    }
+}
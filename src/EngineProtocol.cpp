@@ -0,0 +1,209 @@
+#include "headers/EngineProtocol.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <stdexcept>
+
+namespace {
+    constexpr std::size_t DEFAULT_HASH_MEGABYTES = 16;
+
+    std::string formatScore(int score) {
+        if (isWinScore(score)) {
+            int plies = WIN_SCORE - (score > 0 ? score : -score);
+            int moves = (plies + 1) / 2;
+            return fmt::format("mate {}", score > 0 ? moves : -moves);
+        }
+        return fmt::format("cp {}", score * 100 / MATERIAL_WEIGHT);
+    }
+}
+
+EngineProtocol::EngineProtocol(std::istream &input, std::ostream &output) : input(input), output(output),
+                                                                            search(DEFAULT_HASH_MEGABYTES),
+                                                                            stopSignal(false),
+                                                                            ponderSignal(false),
+                                                                            holdBestMove(false), multiPv(1) {
+    search.setIterationCallback([this](SearchResult const &result, SearchStatistics const &statistics) {
+        reportIteration(result, statistics);
+    });
+}
+
+EngineProtocol::~EngineProtocol() {
+    stopSearch();
+}
+
+void EngineProtocol::run() {
+    std::string line;
+    while (std::getline(input, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        try {
+            if (!handle(line)) break;
+        } catch (std::exception const &error) {
+            send(std::string("info string ") + error.what());
+        }
+    }
+    stopSearch();
+}
+
+bool EngineProtocol::handle(std::string const &line) {
+    std::istringstream arguments(line);
+    std::string command;
+    arguments >> command;
+
+    if (command == "hxi" || command == "uci") {
+        send("id name Hexxagon");
+        send("option name Hash type spin default 16 min 1 max 4096");
+        send(fmt::format("option name MultiPV type spin default 1 min 1 max {}", MAX_MULTI_PV));
+        send(command + "ok");
+    } else if (command == "isready") {
+        send("readyok");
+    } else if (command == "setoption") {
+        stopSearch();
+        setOption(arguments);
+    } else if (command == "newgame" || command == "ucinewgame") {
+        stopSearch();
+        search.clearHash();
+    } else if (command == "position") {
+        stopSearch();
+        setPosition(arguments);
+    } else if (command == "go") {
+        stopSearch();
+        go(arguments);
+    } else if (command == "stop") {
+        stopSearch();
+    } else if (command == "ponderhit") {
+        ponderSignal = false;
+        releaseBestMove();
+    } else if (command == "d") {
+        send("info string " + position.toString());
+    } else if (command == "quit") {
+        return false;
+    } else if (!command.empty()) {
+        send("info string Unknown command: " + command);
+    }
+    return true;
+}
+
+void EngineProtocol::send(std::string const &line) {
+    std::lock_guard lock(outputMutex);
+    output << line << std::endl;
+}
+
+void EngineProtocol::setOption(std::istringstream &arguments) {
+    std::string token, name, value;
+    arguments >> token >> name >> token >> value;
+
+    if (name == "Hash") {
+        search.setHashSize(std::stoull(value));
+    } else if (name == "MultiPV") {
+        multiPv = std::clamp(std::stoi(value), 1, MAX_MULTI_PV);
+    } else {
+        send("info string Unknown option: " + name);
+    }
+}
+
+//position startpos [moves m1 m2 ...] | position save <62-character save string> [moves ...]
+void EngineProtocol::setPosition(std::istringstream &arguments) {
+    std::string token;
+    arguments >> token;
+
+    Position newPosition;
+    if (token == "save") {
+        arguments >> token;
+        newPosition = Position::fromString(token);
+    } else if (token != "startpos") {
+        throw std::runtime_error("Expected startpos or save");
+    }
+
+    arguments >> token;
+    if (arguments && token == "moves") {
+        while (arguments >> token) {
+            newPosition.makeMove(newPosition.parseMove(token));
+        }
+    }
+    position = newPosition;
+}
+
+//go [depth N] [movetime MS] [nodes N] [atime MS] [btime MS] [ainc MS] [binc MS] [infinite] [ponder]
+void EngineProtocol::go(std::istringstream &arguments) {
+    SearchLimits limits;
+    bool infinite = false, ponder = false;
+    std::array<std::int64_t, 2> times = {-1, -1}, increments = {0, 0};
+    std::string token;
+
+    while (arguments >> token) {
+        if (token == "depth") arguments >> limits.depth;
+        else if (token == "movetime") arguments >> limits.milliseconds;
+        else if (token == "nodes") arguments >> limits.nodes;
+        else if (token == "atime") arguments >> times[0];
+        else if (token == "btime") arguments >> times[1];
+        else if (token == "ainc") arguments >> increments[0];
+        else if (token == "binc") arguments >> increments[1];
+        else if (token == "infinite") infinite = true;
+        else if (token == "ponder") ponder = true;
+    }
+
+    //ONLY THE CLOCK OF THE SIDE TO MOVE MATTERS
+    int side = position.getSideToMove() == Player::PLAYER_B ? 1 : 0;
+    if (times[side] >= 0 && !infinite) {
+        timeManager.start(position, times[side], increments[side]);
+        limits.timeManager = &timeManager;
+    }
+
+    stopSignal = false;
+    ponderSignal = ponder;
+    holdBestMove = infinite || ponder;
+    limits.stopSignal = &stopSignal;
+    limits.ponderSignal = &ponderSignal;
+    limits.multiPv = multiPv;
+
+    searchThread = std::thread([this, limits]() { searchAndReport(limits); });
+}
+
+void EngineProtocol::searchAndReport(SearchLimits limits) {
+    auto result = search.run(position, limits);
+
+    //AFTER go infinite OR go ponder THE BEST MOVE IS ONLY SENT ONCE THE GUI SAYS stop OR ponderhit
+    {
+        std::unique_lock lock(waitMutex);
+        waitForRelease.wait(lock, [this]() { return !holdBestMove || stopSignal; });
+    }
+
+    std::string line = "bestmove " + (result.bestMove.isNull() ? std::string("0000") : result.bestMove.toString());
+    if (result.principalVariation.size() > 1) {
+        line += " ponder " + result.principalVariation[1].toString();
+    }
+    send(line);
+}
+
+void EngineProtocol::reportIteration(SearchResult const &result, SearchStatistics const &statistics) {
+    //ONE LINE PER PV, THE multipv FIELD ONLY APPEARS WHEN MORE THAN ONE WAS ASKED FOR
+    for (int i = 0; i < result.lineCount; i++) {
+        auto const &searchLine = result.lines[i];
+        std::string line = fmt::format("info depth {} seldepth {}", result.depth, statistics.selectiveDepth);
+        if (multiPv > 1) line += fmt::format(" multipv {}", i + 1);
+        line += fmt::format(" score {} nodes {} nps {:.0f} time {} pv", formatScore(searchLine.score),
+                            statistics.nodes, statistics.getNodesPerSecond(), statistics.microseconds / 1000);
+        for (auto move: searchLine.principalVariation) {
+            line += ' ' + move.toString();
+        }
+        send(line);
+    }
+}
+
+void EngineProtocol::releaseBestMove() {
+    std::lock_guard lock(waitMutex);
+    holdBestMove = false;
+    waitForRelease.notify_all();
+}
+
+void EngineProtocol::stopSearch() {
+    if (!searchThread.joinable()) return;
+
+    {
+        std::lock_guard lock(waitMutex);
+        stopSignal = true;
+        waitForRelease.notify_all();
+    }
+    searchThread.join();
+}
@@ -0,0 +1,38 @@
+#include "headers/Evaluation.hpp"
+#include "headers/NTupleNetwork.hpp"
+
+int evaluate(Position const &position) {
+    if (auto const *network = getEvaluationNetwork()) {
+        return network->evaluate(position);
+    }
+
+    Player us = position.getSideToMove();
+    return evaluateBitboards(position.getPieces(us), position.getPieces(opponentOf(us)));
+}
+
+bool isTerminal(Position const &position) {
+    return position.isGameOver() || !position.hasMoves();
+}
+
+int finalPointsDifference(Position const &position) {
+    Player us = position.getSideToMove();
+    int ownPoints = position.getPoints(us);
+    int enemyPoints = position.getPoints(opponentOf(us));
+
+    //A PLAYER WHO CANNOT MOVE ENDS THE GAME AND THE OPPONENT TAKES ALL EMPTY FIELDS
+    if (!position.isGameOver()) {
+        enemyPoints += CELL_COUNT - ownPoints - enemyPoints;
+    }
+    return ownPoints - enemyPoints;
+}
+
+int terminalScore(Position const &position, int ply) {
+    int difference = finalPointsDifference(position);
+    if (difference > 0) return WIN_SCORE - ply;
+    if (difference < 0) return -WIN_SCORE + ply;
+    return 0;
+}
+
+bool isWinScore(int score) {
+    return score > WIN_SCORE - MAX_PLY || score < -WIN_SCORE + MAX_PLY;
+}
@@ -0,0 +1,389 @@
+#include "headers/Evaluation.hpp"
+#include "headers/NTupleNetwork.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define HEXXAGON_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+//WITHOUT A NETWORK EVERY KERNEL COMPUTES THE SAME FEATURES FOR A LANE OF POSITIONS:
+//  dilation  - CELLS ADJACENT TO AT LEAST ONE PIECE OF A GIVEN KIND
+//  capture   - BEST NUMBER OF ENEMY NEIGHBOURS OF AN EMPTY CELL THE PLAYER CAN REACH WITH A CLONE OR A JUMP
+//WITH A NETWORK THE KERNELS TAKE ONE TUPLE AT A TIME, INDEX IT IN EVERY POSITION OF THE BATCH AND ADD ITS WEIGHTS
+//TO ONE int32 SUM PER POSITION.
+namespace {
+    using NetworkSums = std::array<int, EVALUATION_BATCH_SIZE>;
+
+    struct LaneFeatures {
+        Bitboard ownDilation, enemyDilation, emptyDilation;
+        int ownCapture, enemyCapture;
+    };
+
+    struct KernelTables {
+        std::array<Bitboard, CELL_COUNT> reach{};
+    };
+
+    constexpr KernelTables makeKernelTables() {
+        KernelTables tables;
+        for (int cell = 0; cell < CELL_COUNT; cell++) {
+            tables.reach[cell] = CELLS.neighbours[cell] | CELLS.jumps[cell];
+        }
+        return tables;
+    }
+
+    constexpr KernelTables TABLES = makeKernelTables();
+
+    int combineFeatures(Bitboard own, Bitboard enemy, LaneFeatures const &features) {
+        Bitboard empty = ALL_CELLS & ~(own | enemy);
+        int material = std::popcount(own) - std::popcount(enemy);
+        int mobility = std::popcount(features.ownDilation & empty) - std::popcount(features.enemyDilation & empty);
+        int frontier = std::popcount(own & features.emptyDilation) - std::popcount(enemy & features.emptyDilation);
+
+        return MATERIAL_WEIGHT * material + MOBILITY_WEIGHT * mobility + FRONTIER_WEIGHT * frontier +
+               OWN_CAPTURE_WEIGHT * features.ownCapture + ENEMY_CAPTURE_WEIGHT * features.enemyCapture;
+    }
+
+    LaneFeatures scalarFeatures(Bitboard own, Bitboard enemy) {
+        Bitboard empty = ALL_CELLS & ~(own | enemy);
+        LaneFeatures features{0, 0, 0, 0, 0};
+        Bitboard ownReach = 0, enemyReach = 0;
+
+        for (Bitboard cells = own; cells; cells &= cells - 1) {
+            int cell = std::countr_zero(cells);
+            features.ownDilation |= CELLS.neighbours[cell];
+            ownReach |= TABLES.reach[cell];
+        }
+        for (Bitboard cells = enemy; cells; cells &= cells - 1) {
+            int cell = std::countr_zero(cells);
+            features.enemyDilation |= CELLS.neighbours[cell];
+            enemyReach |= TABLES.reach[cell];
+        }
+        for (Bitboard cells = empty; cells; cells &= cells - 1) {
+            int cell = std::countr_zero(cells);
+            features.emptyDilation |= CELLS.neighbours[cell];
+            if (ownReach & cellBit(cell)) {
+                features.ownCapture = std::max(features.ownCapture, std::popcount(CELLS.neighbours[cell] & enemy));
+            }
+            if (enemyReach & cellBit(cell)) {
+                features.enemyCapture = std::max(features.enemyCapture, std::popcount(CELLS.neighbours[cell] & own));
+            }
+        }
+        return features;
+    }
+
+    void scalarKernel(Bitboard const *own, Bitboard const *enemy, int count, int *scores) {
+        for (int i = 0; i < count; i++) {
+            scores[i] = combineFeatures(own[i], enemy[i], scalarFeatures(own[i], enemy[i]));
+        }
+    }
+
+    void scalarNetworkKernel(NTupleNetwork const &network, Bitboard const *own, Bitboard const *enemy,
+                             NetworkSums &sums) {
+        auto const &weights = network.getWidenedWeights();
+        sums.fill(0);
+        for (auto const &tuple: network.getTuples()) {
+            for (int lane = 0; lane < EVALUATION_BATCH_SIZE; lane++) {
+                sums[lane] += weights[tuple.tableOffset + NTupleNetwork::tupleIndex(tuple, own[lane], enemy[lane])];
+            }
+        }
+    }
+
+#ifdef HEXXAGON_X86_KERNELS
+    //https://arxiv.org/abs/1611.07612 (NIBBLE LOOKUP POPCOUNT, SUMMED PER 64-BIT LANE WITH psadbw)
+    __attribute__((target("avx2"))) __m256i popcount256(__m256i value) {
+        __m256i const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        __m256i const lowMask = _mm256_set1_epi8(0x0F);
+        __m256i low = _mm256_and_si256(value, lowMask);
+        __m256i high = _mm256_and_si256(_mm256_srli_epi16(value, 4), lowMask);
+        __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+        return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+    }
+
+    __attribute__((target("avx2"))) void avx2Kernel(Bitboard const *own, Bitboard const *enemy, int count,
+                                                    int *scores) {
+        __m256i const zero = _mm256_setzero_si256();
+        __m256i const allCells = _mm256_set1_epi64x(static_cast<long long>(ALL_CELLS));
+        alignas(32) std::array<Bitboard, 4> lanes[3];
+        alignas(32) std::array<long long, 4> captures[2];
+
+        for (int base = 0; base < count; base += 4) {
+            alignas(32) std::array<Bitboard, 4> ownLane{}, enemyLane{};
+            int width = std::min(4, count - base);
+            std::copy_n(own + base, width, ownLane.begin());
+            std::copy_n(enemy + base, width, enemyLane.begin());
+
+            __m256i ownPieces = _mm256_load_si256(reinterpret_cast<__m256i const *>(ownLane.data()));
+            __m256i enemyPieces = _mm256_load_si256(reinterpret_cast<__m256i const *>(enemyLane.data()));
+            __m256i empty = _mm256_andnot_si256(_mm256_or_si256(ownPieces, enemyPieces), allCells);
+            __m256i ownDilation = zero, enemyDilation = zero, emptyDilation = zero;
+            __m256i ownCapture = zero, enemyCapture = zero;
+
+            for (int cell = 0; cell < CELL_COUNT; cell++) {
+                __m256i neighbours = _mm256_set1_epi64x(static_cast<long long>(CELLS.neighbours[cell]));
+                __m256i reach = _mm256_set1_epi64x(static_cast<long long>(TABLES.reach[cell]));
+                __m256i bit = _mm256_set1_epi64x(static_cast<long long>(cellBit(cell)));
+
+                __m256i ownNeighbours = _mm256_and_si256(neighbours, ownPieces);
+                __m256i enemyNeighbours = _mm256_and_si256(neighbours, enemyPieces);
+                __m256i noOwn = _mm256_cmpeq_epi64(ownNeighbours, zero);
+                __m256i noEnemy = _mm256_cmpeq_epi64(enemyNeighbours, zero);
+                __m256i noEmpty = _mm256_cmpeq_epi64(_mm256_and_si256(neighbours, empty), zero);
+                ownDilation = _mm256_or_si256(ownDilation, _mm256_andnot_si256(noOwn, bit));
+                enemyDilation = _mm256_or_si256(enemyDilation, _mm256_andnot_si256(noEnemy, bit));
+                emptyDilation = _mm256_or_si256(emptyDilation, _mm256_andnot_si256(noEmpty, bit));
+
+                __m256i isEmpty = _mm256_cmpeq_epi64(_mm256_and_si256(empty, bit), bit);
+                __m256i ownReaches = _mm256_andnot_si256(
+                        _mm256_cmpeq_epi64(_mm256_and_si256(reach, ownPieces), zero), isEmpty);
+                __m256i enemyReaches = _mm256_andnot_si256(
+                        _mm256_cmpeq_epi64(_mm256_and_si256(reach, enemyPieces), zero), isEmpty);
+
+                //COUNTS FIT IN THE LOW 32 BITS OF EVERY LANE, SO A 32-BIT MAX IS ENOUGH
+                ownCapture = _mm256_max_epi32(ownCapture, _mm256_and_si256(ownReaches, popcount256(enemyNeighbours)));
+                enemyCapture = _mm256_max_epi32(enemyCapture,
+                                                _mm256_and_si256(enemyReaches, popcount256(ownNeighbours)));
+            }
+
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lanes[0].data()), ownDilation);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lanes[1].data()), enemyDilation);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lanes[2].data()), emptyDilation);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(captures[0].data()), ownCapture);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(captures[1].data()), enemyCapture);
+
+            for (int lane = 0; lane < width; lane++) {
+                LaneFeatures features{lanes[0][lane], lanes[1][lane], lanes[2][lane],
+                                      static_cast<int>(captures[0][lane]), static_cast<int>(captures[1][lane])};
+                scores[base + lane] = combineFeatures(ownLane[lane], enemyLane[lane], features);
+            }
+        }
+    }
+
+    //THE CELL STATES OF ALL LANES ARE 0, 1 OR 2, SO INDICES STAY FAR BELOW 2^32: _mm256_mul_epu32 MULTIPLIES THEM
+    //EXACTLY AND THE 64-BIT INDEX GATHER LOADS 4 WEIGHTS PER VECTOR OF BITBOARDS
+    __attribute__((target("avx2"))) void avx2NetworkKernel(NTupleNetwork const &network, Bitboard const *own,
+                                                           Bitboard const *enemy, NetworkSums &sums) {
+        constexpr int VECTORS = EVALUATION_BATCH_SIZE / 4;
+        static_assert(EVALUATION_BATCH_SIZE % 4 == 0);
+        int const *weights = network.getWidenedWeights().data();
+        __m256i const one = _mm256_set1_epi64x(1);
+        __m256i ownPieces[VECTORS], enemyPieces[VECTORS], indices[VECTORS];
+        __m128i lanes[VECTORS];
+        for (int v = 0; v < VECTORS; v++) {
+            ownPieces[v] = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(own + 4 * v));
+            enemyPieces[v] = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(enemy + 4 * v));
+            lanes[v] = _mm_setzero_si128();
+        }
+
+        for (auto const &tuple: network.getTuples()) {
+            for (auto &index: indices) index = _mm256_set1_epi64x(tuple.tableOffset);
+            int power = 1;
+            for (int i = 0; i < NTUPLE_LENGTH; i++, power *= 3) {
+                if (tuple.cells[i] < 0) continue;
+                __m128i shift = _mm_cvtsi32_si128(tuple.cells[i]);
+                __m256i multiplier = _mm256_set1_epi64x(power);
+                for (int v = 0; v < VECTORS; v++) {
+                    __m256i ownBit = _mm256_and_si256(_mm256_srl_epi64(ownPieces[v], shift), one);
+                    __m256i enemyBit = _mm256_and_si256(_mm256_srl_epi64(enemyPieces[v], shift), one);
+                    __m256i state = _mm256_add_epi64(ownBit, _mm256_add_epi64(enemyBit, enemyBit));
+                    indices[v] = _mm256_add_epi64(indices[v], _mm256_mul_epu32(state, multiplier));
+                }
+            }
+            for (int v = 0; v < VECTORS; v++) {
+                lanes[v] = _mm_add_epi32(lanes[v], _mm256_i64gather_epi32(weights, indices[v], 4));
+            }
+        }
+        for (int v = 0; v < VECTORS; v++) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(sums.data() + 4 * v), lanes[v]);
+        }
+    }
+
+    __attribute__((target("sse4.1"))) __m128i popcount128(__m128i value) {
+        __m128i const lookup = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        __m128i const lowMask = _mm_set1_epi8(0x0F);
+        __m128i low = _mm_and_si128(value, lowMask);
+        __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), lowMask);
+        __m128i counts = _mm_add_epi8(_mm_shuffle_epi8(lookup, low), _mm_shuffle_epi8(lookup, high));
+        return _mm_sad_epu8(counts, _mm_setzero_si128());
+    }
+
+    __attribute__((target("sse4.1"))) void sse4Kernel(Bitboard const *own, Bitboard const *enemy, int count,
+                                                      int *scores) {
+        __m128i const zero = _mm_setzero_si128();
+        __m128i const allCells = _mm_set1_epi64x(static_cast<long long>(ALL_CELLS));
+        alignas(16) std::array<Bitboard, 2> lanes[3];
+        alignas(16) std::array<long long, 2> captures[2];
+
+        for (int base = 0; base < count; base += 2) {
+            alignas(16) std::array<Bitboard, 2> ownLane{}, enemyLane{};
+            int width = std::min(2, count - base);
+            std::copy_n(own + base, width, ownLane.begin());
+            std::copy_n(enemy + base, width, enemyLane.begin());
+
+            __m128i ownPieces = _mm_load_si128(reinterpret_cast<__m128i const *>(ownLane.data()));
+            __m128i enemyPieces = _mm_load_si128(reinterpret_cast<__m128i const *>(enemyLane.data()));
+            __m128i empty = _mm_andnot_si128(_mm_or_si128(ownPieces, enemyPieces), allCells);
+            __m128i ownDilation = zero, enemyDilation = zero, emptyDilation = zero;
+            __m128i ownCapture = zero, enemyCapture = zero;
+
+            for (int cell = 0; cell < CELL_COUNT; cell++) {
+                __m128i neighbours = _mm_set1_epi64x(static_cast<long long>(CELLS.neighbours[cell]));
+                __m128i reach = _mm_set1_epi64x(static_cast<long long>(TABLES.reach[cell]));
+                __m128i bit = _mm_set1_epi64x(static_cast<long long>(cellBit(cell)));
+
+                __m128i ownNeighbours = _mm_and_si128(neighbours, ownPieces);
+                __m128i enemyNeighbours = _mm_and_si128(neighbours, enemyPieces);
+                __m128i noOwn = _mm_cmpeq_epi64(ownNeighbours, zero);
+                __m128i noEnemy = _mm_cmpeq_epi64(enemyNeighbours, zero);
+                __m128i noEmpty = _mm_cmpeq_epi64(_mm_and_si128(neighbours, empty), zero);
+                ownDilation = _mm_or_si128(ownDilation, _mm_andnot_si128(noOwn, bit));
+                enemyDilation = _mm_or_si128(enemyDilation, _mm_andnot_si128(noEnemy, bit));
+                emptyDilation = _mm_or_si128(emptyDilation, _mm_andnot_si128(noEmpty, bit));
+
+                __m128i isEmpty = _mm_cmpeq_epi64(_mm_and_si128(empty, bit), bit);
+                __m128i ownReaches = _mm_andnot_si128(_mm_cmpeq_epi64(_mm_and_si128(reach, ownPieces), zero), isEmpty);
+                __m128i enemyReaches = _mm_andnot_si128(_mm_cmpeq_epi64(_mm_and_si128(reach, enemyPieces), zero),
+                                                        isEmpty);
+
+                ownCapture = _mm_max_epi32(ownCapture, _mm_and_si128(ownReaches, popcount128(enemyNeighbours)));
+                enemyCapture = _mm_max_epi32(enemyCapture, _mm_and_si128(enemyReaches, popcount128(ownNeighbours)));
+            }
+
+            _mm_store_si128(reinterpret_cast<__m128i *>(lanes[0].data()), ownDilation);
+            _mm_store_si128(reinterpret_cast<__m128i *>(lanes[1].data()), enemyDilation);
+            _mm_store_si128(reinterpret_cast<__m128i *>(lanes[2].data()), emptyDilation);
+            _mm_store_si128(reinterpret_cast<__m128i *>(captures[0].data()), ownCapture);
+            _mm_store_si128(reinterpret_cast<__m128i *>(captures[1].data()), enemyCapture);
+
+            for (int lane = 0; lane < width; lane++) {
+                LaneFeatures features{lanes[0][lane], lanes[1][lane], lanes[2][lane],
+                                      static_cast<int>(captures[0][lane]), static_cast<int>(captures[1][lane])};
+                scores[base + lane] = combineFeatures(ownLane[lane], enemyLane[lane], features);
+            }
+        }
+    }
+
+    //SSE4.1 HAS NO GATHER, THE INDICES ARE COMPUTED 2 LANES AT A TIME AND THE WEIGHTS LOADED ONE BY ONE
+    __attribute__((target("sse4.1"))) void sse4NetworkKernel(NTupleNetwork const &network, Bitboard const *own,
+                                                             Bitboard const *enemy, NetworkSums &sums) {
+        constexpr int VECTORS = EVALUATION_BATCH_SIZE / 2;
+        static_assert(EVALUATION_BATCH_SIZE % 2 == 0);
+        int const *weights = network.getWidenedWeights().data();
+        __m128i const one = _mm_set1_epi64x(1);
+        __m128i ownPieces[VECTORS], enemyPieces[VECTORS], indices[VECTORS];
+        alignas(16) std::array<long long, EVALUATION_BATCH_SIZE> laneIndices;
+        for (int v = 0; v < VECTORS; v++) {
+            ownPieces[v] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(own + 2 * v));
+            enemyPieces[v] = _mm_loadu_si128(reinterpret_cast<__m128i const *>(enemy + 2 * v));
+        }
+        sums.fill(0);
+
+        for (auto const &tuple: network.getTuples()) {
+            for (auto &index: indices) index = _mm_set1_epi64x(tuple.tableOffset);
+            int power = 1;
+            for (int i = 0; i < NTUPLE_LENGTH; i++, power *= 3) {
+                if (tuple.cells[i] < 0) continue;
+                __m128i shift = _mm_cvtsi32_si128(tuple.cells[i]);
+                __m128i multiplier = _mm_set1_epi64x(power);
+                for (int v = 0; v < VECTORS; v++) {
+                    __m128i ownBit = _mm_and_si128(_mm_srl_epi64(ownPieces[v], shift), one);
+                    __m128i enemyBit = _mm_and_si128(_mm_srl_epi64(enemyPieces[v], shift), one);
+                    __m128i state = _mm_add_epi64(ownBit, _mm_add_epi64(enemyBit, enemyBit));
+                    indices[v] = _mm_add_epi64(indices[v], _mm_mul_epu32(state, multiplier));
+                }
+            }
+            for (int v = 0; v < VECTORS; v++) {
+                _mm_store_si128(reinterpret_cast<__m128i *>(laneIndices.data() + 2 * v), indices[v]);
+            }
+            for (int lane = 0; lane < EVALUATION_BATCH_SIZE; lane++) {
+                sums[lane] += weights[laneIndices[lane]];
+            }
+        }
+    }
+#endif
+
+    void networkKernel(EvaluationKernel kernel, NTupleNetwork const &network, Bitboard const *own,
+                       Bitboard const *enemy, NetworkSums &sums) {
+#ifdef HEXXAGON_X86_KERNELS
+        if (kernel == EvaluationKernel::AVX2) {
+            avx2NetworkKernel(network, own, enemy, sums);
+            return;
+        }
+        if (kernel == EvaluationKernel::SSE4) {
+            sse4NetworkKernel(network, own, enemy, sums);
+            return;
+        }
+#endif
+        scalarNetworkKernel(network, own, enemy, sums);
+    }
+
+    EvaluationKernel detectKernel() {
+#ifdef HEXXAGON_X86_KERNELS
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return EvaluationKernel::AVX2;
+        if (__builtin_cpu_supports("sse4.1")) return EvaluationKernel::SSE4;
+#endif
+        return EvaluationKernel::SCALAR;
+    }
+
+    std::atomic<EvaluationKernel> &activeKernel() {
+        static std::atomic<EvaluationKernel> kernel(detectKernel());
+        return kernel;
+    }
+}
+
+int evaluateBitboards(Bitboard own, Bitboard enemy) {
+    return combineFeatures(own, enemy, scalarFeatures(own, enemy));
+}
+
+void evaluateBatch(Position const *positions, int count, int *scores) {
+    auto const *network = getEvaluationNetwork();
+    EvaluationKernel kernel = activeKernel().load(std::memory_order_relaxed);
+
+    for (int base = 0; base < count; base += EVALUATION_BATCH_SIZE) {
+        std::array<Bitboard, EVALUATION_BATCH_SIZE> own{}, enemy{};
+        int width = std::min(EVALUATION_BATCH_SIZE, count - base);
+        for (int i = 0; i < width; i++) {
+            Player us = positions[base + i].getSideToMove();
+            own[i] = positions[base + i].getPieces(us);
+            enemy[i] = positions[base + i].getPieces(opponentOf(us));
+        }
+
+        //UNUSED LANES HOLD THE EMPTY BOARD, WHOSE INDICES ARE VALID
+        if (network) {
+            NetworkSums sums;
+            networkKernel(kernel, *network, own.data(), enemy.data(), sums);
+            for (int i = 0; i < width; i++) {
+                scores[base + i] = NTupleNetwork::toEvaluation(sums[i]);
+            }
+            continue;
+        }
+
+#ifdef HEXXAGON_X86_KERNELS
+        if (kernel == EvaluationKernel::AVX2) {
+            avx2Kernel(own.data(), enemy.data(), width, scores + base);
+            continue;
+        }
+        if (kernel == EvaluationKernel::SSE4) {
+            sse4Kernel(own.data(), enemy.data(), width, scores + base);
+            continue;
+        }
+#endif
+        scalarKernel(own.data(), enemy.data(), width, scores + base);
+    }
+}
+
+EvaluationKernel getEvaluationKernel() {
+    return activeKernel().load();
+}
+
+void setEvaluationKernel(EvaluationKernel kernel) {
+    //ONLY DOWNGRADES ARE ALLOWED, A KERNEL THE CPU DOES NOT SUPPORT WOULD CRASH
+    if (static_cast<int>(kernel) <= static_cast<int>(detectKernel())) {
+        activeKernel() = kernel;
+    }
+}
@@ -0,0 +1,52 @@
+#include "headers/ExplorerPanel.hpp"
+#include <fmt/format.h>
+
+namespace {
+    constexpr int SHOWN_CONTINUATIONS = 6;
+}
+
+ExplorerPanel::ExplorerPanel(sf::RenderWindow &window) : window(window), shownKey(0), hasShownKey(false) {
+    if (!font.loadFromFile("../fonts/Silkscreen-Regular.ttf")) {
+        throw std::runtime_error("Unable to load the font.");
+    }
+
+    text.setFont(font);
+    text.setCharacterSize(14);
+    text.setFillColor(sf::Color::White);
+    text.setPosition(window.getSize().x - 210, 140);
+}
+
+void ExplorerPanel::draw() {
+    window.draw(text);
+}
+
+void ExplorerPanel::update(GameDatabase const &database, Position const &position) {
+    if (hasShownKey && position.hash() == shownKey) {
+        return;
+    }
+    shownKey = position.hash();
+    hasShownKey = true;
+
+    PositionStatistics statistics;
+    if (!database.lookup(position, statistics)) {
+        text.setString(fmt::format("Explorer\n{} games\n\nPosition not found", database.getGameCount()));
+        return;
+    }
+
+    //THE LIST SHOWS HOW MANY GAMES REACHED EACH NEXT POSITION, BY ANY MOVE ORDER
+    std::string content = fmt::format("Explorer\n{} games\nWin {:.0f}% Draw {:.0f}%\n\nReaching next:\n",
+                                      statistics.games, statistics.getWinRate() * 100,
+                                      100.0 * statistics.getDraws() / statistics.games);
+    int shown = 0;
+    for (auto const &continuation: database.getContinuations(position)) {
+        if (shown++ == SHOWN_CONTINUATIONS) break;
+        content += fmt::format("{:<5}{:>6} {:>3.0f}%\n", continuation.move.toString(), continuation.statistics.games,
+                               continuation.statistics.getWinRate() * 100);
+    }
+    text.setString(content);
+}
+
+void ExplorerPanel::showUnavailable() {
+    text.setString("Explorer\n\nNo game database");
+    hasShownKey = false;
+}
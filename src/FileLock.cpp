@@ -0,0 +1,68 @@
+#include "headers/FileLock.hpp"
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+FileLock::FileLock() : file(INVALID_HANDLE_VALUE) {}
+
+bool FileLock::tryLock(std::string const &path) {
+    unlock();
+    file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                       OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    OVERLAPPED overlapped{};
+    if (!LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &overlapped)) {
+        unlock();
+        return false;
+    }
+    return true;
+}
+
+void FileLock::unlock() {
+    //CLOSING THE HANDLE RELEASES THE LOCK
+    if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+    file = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+FileLock::FileLock() : fd(-1) {}
+
+bool FileLock::tryLock(std::string const &path) {
+    unlock();
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    if (flock(fd, LOCK_EX | LOCK_NB) < 0) {
+        unlock();
+        return false;
+    }
+    return true;
+}
+
+void FileLock::unlock() {
+    //CLOSING THE DESCRIPTOR RELEASES THE LOCK
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+}
+
+#endif
+
+FileLock::~FileLock() {
+    unlock();
+}
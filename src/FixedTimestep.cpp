@@ -0,0 +1,41 @@
+#include "headers/FixedTimestep.hpp"
+#include <algorithm>
+
+namespace {
+    constexpr double MAXIMUM_FRAME_SECONDS = 0.25;
+}
+
+FixedTimestep::FixedTimestep(int stepsPerSecond) : stepSeconds(1.0 / stepsPerSecond), accumulator(0), timeScale(1) {
+    reset();
+}
+
+int FixedTimestep::advance() {
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - lastAdvance).count();
+    lastAdvance = now;
+    return advance(elapsed);
+}
+
+int FixedTimestep::advance(double elapsedSeconds) {
+    accumulator += std::clamp(elapsedSeconds, 0.0, MAXIMUM_FRAME_SECONDS) * timeScale;
+    auto steps = static_cast<int>(accumulator / stepSeconds);
+    accumulator -= steps * stepSeconds;
+    return steps;
+}
+
+double FixedTimestep::getAlpha() const {
+    return accumulator / stepSeconds;
+}
+
+void FixedTimestep::setTimeScale(double scale) {
+    timeScale = std::max(0.0, scale);
+}
+
+double FixedTimestep::getTimeScale() const {
+    return timeScale;
+}
+
+void FixedTimestep::reset() {
+    accumulator = 0;
+    lastAdvance = std::chrono::steady_clock::now();
+}
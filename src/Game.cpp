@@ -1,11 +1,29 @@
 #include "headers/Game.hpp"
+#include "headers/AllocationCounter.hpp"
+
+namespace {
+    constexpr int ANALYSIS_LINES = 4;
+    constexpr std::size_t ANALYSIS_HASH_MEGABYTES = 64;
+    //THE ANALYZER PUBLISHES EVERY ITERATION, THE PANEL IS REFORMATTED AT MOST THIS OFTEN
+    constexpr int ANALYSIS_POLL_MILLISECONDS = 100;
+}
 
 Game::Game(sf::RenderWindow &window) : window(window), gameState(GameState::Menu), hexBoard(9, 9, 35, window),
                                        savedGamesMenu(window, *this), pauseMenu(window, *this),
-                                       mainMenu(window, *this) {}
+                                       mainMenu(window, *this), engine(16), statisticsOverlay(window),
+                                       statisticsVisible(false), moveAllocations(0), explorerPanel(window),
+                                       explorerVisible(false), analysisPanel(window), analysing(false), analysedKey(0),
+                                       scheduler(std::max(1,
+                                                          static_cast<int>(std::thread::hardware_concurrency()) - 1)) {}
+
+Game::~Game() {
+    analyzer.reset();
+}
 
 void Game::run() {
     while (window.isOpen()) {
+        scheduler.runContinuations();
+
         sf::Event event;
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed) {
@@ -19,19 +37,51 @@ void Game::run() {
                 } else if (gameState == GameState::SavedGamesMenu) {
                     savedGamesMenu.onMouseClick(mouseX, mouseY);
                 } else if (gameState == GameState::Game) {
+                    hintToken.cancel();
+                    AllocationScope moveScope;
                     hexBoard.onMouseClick(mouseX, mouseY);
+                    moveAllocations = moveScope.getAllocations();
                 } else if (gameState == GameState::Paused) {
                     pauseMenu.onMouseClick(mouseX, mouseY);
                 }
+            } else if (event.type == sf::Event::MouseMoved && gameState == GameState::Game) {
+                hexBoard.onMouseMove(static_cast<float>(event.mouseMove.x), static_cast<float>(event.mouseMove.y));
             } else if (event.type == sf::Event::KeyPressed) {
                 if (event.key.code == sf::Keyboard::Escape && gameState == GameState::Game) {
+                    hexBoard.pauseClock();
                     gameState = GameState::Paused;
                 } else if (event.key.code == sf::Keyboard::Escape && gameState == GameState::Paused) {
-                    gameState = GameState::Game;
+                    switchToGame();
+                } else if (event.key.code == sf::Keyboard::H && gameState == GameState::Game) {
+                    showHint();
+                } else if (event.key.code == sf::Keyboard::T && gameState == GameState::Game) {
+                    hexBoard.toggleThreats();
+                } else if (event.key.code == sf::Keyboard::E && gameState == GameState::Game) {
+                    toggleExplorer();
+                } else if (event.key.code == sf::Keyboard::A && gameState == GameState::Game) {
+                    toggleAnalysis();
+                } else if (event.key.code == sf::Keyboard::F3) {
+                    statisticsVisible = !statisticsVisible;
                 }
             }
         }
 
+        if (analysing) {
+            updateAnalysis();
+        }
+
+        //THE CLOCKS, THE SIMULATION AND THE DRAWING ARE MEASURED, EVENTS LIKE A MOVE OR A NEW GAME MAY ALLOCATE
+        AllocationScope frameScope;
+
+        //THE SIMULATION ADVANCES IN FIXED STEPS WHATEVER THE FRAME RATE, A PAUSED GAME TAKES NONE
+        int steps = timestep.advance();
+        if (gameState == GameState::Game) {
+            hexBoard.updateClock();
+            for (int i = 0; i < steps; i++) {
+                hexBoard.step();
+            }
+        }
+
         window.clear();
 
         if (gameState == GameState::Menu) {
@@ -41,7 +91,18 @@ void Game::run() {
             savedGamesMenu.draw();
         }
         if (gameState == GameState::Game) {
+            hexBoard.interpolate(timestep.getAlpha());
             hexBoard.draw();
+            if (statisticsVisible) {
+                statisticsOverlay.draw();
+            }
+            if (explorerVisible) {
+                if (database) explorerPanel.update(*database, hexBoard.getPosition());
+                explorerPanel.draw();
+            }
+            if (analysing) {
+                analysisPanel.draw();
+            }
         }
         if (gameState == GameState::Paused) {
             hexBoard.draw();
@@ -49,19 +110,23 @@ void Game::run() {
         }
 
         window.display();
+        statisticsOverlay.updateAllocations(frameScope.getAllocations(), moveAllocations);
     }
 }
 
 void Game::switchToGame() {
+    hexBoard.resumeClock();
     gameState = GameState::Game;
 }
 
 void Game::startNewGame() {
+    hintToken.cancel();
     hexBoard.start();
     gameState = GameState::Game;
 }
 
 void Game::openMainMenu() {
+    if (analysing) toggleAnalysis();
     gameState = GameState::Menu;
 }
 
@@ -71,11 +136,89 @@ void Game::openSavedGamesMenu() {
 }
 
 void Game::saveGame() {
-    hexBoard.save();
+    hexBoard.save(scheduler);
 }
 
 void Game::loadGame(std::string const& fileName) {
+    hintToken.cancel();
     hexBoard.load(fileName);
     gameState = GameState::Game;
 }
 
+void Game::showHint() {
+    //A NEWER HINT REPLACES ONE THAT IS STILL SEARCHING
+    hintToken.cancel();
+    hintToken = CancellationToken();
+    auto token = hintToken;
+    auto position = hexBoard.getPosition();
+
+    scheduler.submitWithContinuation([this, position, token] {
+        std::lock_guard lock(engineMutex);
+        SearchLimits limits;
+        limits.milliseconds = 300;
+        limits.stopSignal = token.getFlag();
+
+        auto result = engine.run(position, limits);
+        return std::make_pair(result.bestMove, engine.getStatistics());
+    }, [this](std::pair<Move, SearchStatistics> const &result) {
+        hexBoard.showHint(result.first);
+        statisticsOverlay.update(result.second);
+    }, TaskPriority::UI_CRITICAL, token);
+}
+
+void Game::toggleAnalysis() {
+    analysing = !analysing;
+    if (analysing && !analyzer) {
+        analyzer = std::make_unique<Analyzer>(scheduler, ANALYSIS_HASH_MEGABYTES, ANALYSIS_LINES);
+    }
+    if (analysing) {
+        //FORCES A RESTART ON THE NEXT FRAME
+        analysedKey = ~hexBoard.getPosition().hash();
+    } else {
+        analyzer->stop();
+    }
+}
+
+void Game::toggleExplorer() {
+    explorerVisible = !explorerVisible;
+    if (!explorerVisible || database) return;
+
+    try {
+        database = std::make_unique<GameDatabase>("../database", DatabaseAccess::READ_ONLY);
+    } catch (std::runtime_error const &) {
+        //TRIED AGAIN THE NEXT TIME THE EXPLORER IS SHOWN
+        explorerPanel.showUnavailable();
+    }
+}
+
+bool Game::isAnalysing() const {
+    return analysing;
+}
+
+void Game::updateAnalysis() {
+    auto const &position = hexBoard.getPosition();
+    if (position.hash() != analysedKey) {
+        analysedKey = position.hash();
+        analysisPanel.reset(position);
+        if (isTerminal(position)) {
+            analyzer->stop();
+        } else {
+            analyzer->analyze(position);
+        }
+    }
+
+    if (analysisPollClock.getElapsedTime().asMilliseconds() < ANALYSIS_POLL_MILLISECONDS) return;
+    analysisPollClock.restart();
+    //A SNAPSHOT OF THE POSITION BEFORE THE LAST MOVE MAY STILL ARRIVE AFTER THE RESTART
+    if (analyzer->poll(analysis) && analysis.position.hash() == analysedKey) {
+        analysisPanel.update(analysis);
+    }
+}
+
+TaskScheduler &Game::getScheduler() {
+    return scheduler;
+}
+
+Board &Game::getBoard() {
+    return hexBoard;
+}
@@ -0,0 +1,76 @@
+#include "headers/GameClock.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+
+GameClock::GameClock(std::int64_t baseMilliseconds, std::int64_t incrementMilliseconds)
+        : baseMilliseconds(baseMilliseconds), incrementMilliseconds(incrementMilliseconds), remaining{0, 0},
+          runningPlayer(Player::NO_PLAYER) {
+    reset();
+}
+
+void GameClock::reset() {
+    remaining[0] = baseMilliseconds;
+    remaining[1] = baseMilliseconds;
+    runningPlayer = Player::NO_PLAYER;
+}
+
+void GameClock::start(Player player) {
+    stop();
+    runningPlayer = player;
+    turnStart = std::chrono::steady_clock::now();
+}
+
+void GameClock::press() {
+    if (runningPlayer == Player::NO_PLAYER) return;
+
+    Player next = runningPlayer == Player::PLAYER_A ? Player::PLAYER_B : Player::PLAYER_A;
+    Player moved = runningPlayer;
+    stop();
+    if (remaining[playerIndex(moved)] > 0) {
+        remaining[playerIndex(moved)] += incrementMilliseconds;
+    }
+    start(next);
+}
+
+void GameClock::stop() {
+    if (runningPlayer == Player::NO_PLAYER) return;
+
+    remaining[playerIndex(runningPlayer)] = getRemainingMilliseconds(runningPlayer);
+    runningPlayer = Player::NO_PLAYER;
+}
+
+std::int64_t GameClock::getRemainingMilliseconds(Player player) const {
+    auto milliseconds = remaining[playerIndex(player)];
+    if (player == runningPlayer) {
+        milliseconds -= std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - turnStart).count();
+    }
+    return std::max<std::int64_t>(0, milliseconds);
+}
+
+std::int64_t GameClock::getIncrementMilliseconds() const {
+    return incrementMilliseconds;
+}
+
+Player GameClock::getRunningPlayer() const {
+    return runningPlayer;
+}
+
+Player GameClock::getFlaggedPlayer() const {
+    if (getRemainingMilliseconds(Player::PLAYER_A) == 0) return Player::PLAYER_A;
+    if (getRemainingMilliseconds(Player::PLAYER_B) == 0) return Player::PLAYER_B;
+    return Player::NO_PLAYER;
+}
+
+std::size_t GameClock::format(std::int64_t milliseconds, char *buffer, std::size_t size) {
+    if (milliseconds < 10000) {
+        return std::min(fmt::format_to_n(buffer, size, "{}.{}", milliseconds / 1000, milliseconds / 100 % 10).size,
+                        size);
+    }
+    auto seconds = milliseconds / 1000;
+    return std::min(fmt::format_to_n(buffer, size, "{}:{:02}", seconds / 60, seconds % 60).size, size);
+}
+
+int GameClock::playerIndex(Player player) {
+    return player == Player::PLAYER_B ? 1 : 0;
+}
@@ -0,0 +1,381 @@
+#include "headers/GameDatabase.hpp"
+#include "headers/Symmetry.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    constexpr std::uint32_t INDEX_VERSION = 3;
+    constexpr std::uint32_t DATABASE_VERSION = 2;
+    constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+    constexpr std::uint64_t INITIAL_CAPACITY = 1 << 16;
+    constexpr int MAGIC_SIZE = 4;
+    //MAGIC, VERSION AND DATABASE ID, THE FIRST RECORD STARTS RIGHT AFTER
+    constexpr int DATABASE_HEADER_SIZE = 16;
+    constexpr int RECORD_HEADER_SIZE = 3;
+}
+
+std::uint32_t PositionStatistics::getDraws() const {
+    return games - wins - losses;
+}
+
+double PositionStatistics::getWinRate() const {
+    return games ? static_cast<double>(wins) / games : 0.0;
+}
+
+GameDatabase::GameDatabase(std::string const &directory, DatabaseAccess access) : access(access), databaseId(0),
+                                                                                    damagedRecord(0) {
+    gamesPath = directory + "/games.hxg";
+    indexPath = directory + "/games.hxi";
+
+    if (access == DatabaseAccess::READ_ONLY) {
+        if (!std::filesystem::exists(gamesPath)) {
+            throw std::runtime_error("No game database in " + directory);
+        }
+        games.open(gamesPath, std::ios::in | std::ios::binary);
+    } else {
+        std::filesystem::create_directories(directory);
+        if (!lock.tryLock(directory + "/games.lock")) {
+            throw std::runtime_error("Game database is in use by another process: " + directory);
+        }
+        if (!std::filesystem::exists(gamesPath) || std::filesystem::file_size(gamesPath) == 0) {
+            std::random_device random;
+            std::uint64_t id = (std::uint64_t(random()) << 32 | random()) | 1;
+            std::array<char, DATABASE_HEADER_SIZE> header{};
+            std::memcpy(header.data(), GAME_DATABASE_MAGIC, MAGIC_SIZE);
+            for (int i = 0; i < 4; i++) header[MAGIC_SIZE + i] = static_cast<char>(DATABASE_VERSION >> 8 * i);
+            for (int i = 0; i < 8; i++) header[MAGIC_SIZE + 4 + i] = static_cast<char>(id >> 8 * i);
+            std::ofstream(gamesPath, std::ios::binary).write(header.data(), DATABASE_HEADER_SIZE);
+        }
+        games.open(gamesPath, std::ios::in | std::ios::out | std::ios::binary);
+    }
+    std::array<unsigned char, DATABASE_HEADER_SIZE> header{};
+    std::uint32_t version = 0;
+    if (games.read(reinterpret_cast<char *>(header.data()), DATABASE_HEADER_SIZE)) {
+        for (int i = 0; i < 4; i++) version |= std::uint32_t(header[MAGIC_SIZE + i]) << 8 * i;
+        for (int i = 0; i < 8; i++) databaseId |= std::uint64_t(header[MAGIC_SIZE + 4 + i]) << 8 * i;
+    }
+    if (!games || std::memcmp(header.data(), GAME_DATABASE_MAGIC, MAGIC_SIZE) != 0 || version != DATABASE_VERSION) {
+        throw std::runtime_error("Incorrect game database: " + gamesPath);
+    }
+
+    if (access == DatabaseAccess::READ_ONLY) {
+        //A READER CANNOT REBUILD THE INDEX, THE NEXT WRITER TO OPEN THE DATABASE DOES
+        index.openReadOnly(indexPath);
+        if (!isValidIndex() || getHeader().indexedBytes > std::filesystem::file_size(gamesPath)) {
+            throw std::runtime_error("Outdated game index: " + indexPath);
+        }
+        return;
+    }
+    openIndex();
+    catchUp();
+}
+
+std::uint64_t GameDatabase::addGame(std::vector<Move> const &moves, Player winner) {
+    if (access == DatabaseAccess::READ_ONLY) {
+        throw std::runtime_error("Game database is open read-only: " + gamesPath);
+    }
+    if (damagedRecord) {
+        throw std::runtime_error("Damaged game record at offset " + std::to_string(damagedRecord) + " in " + gamesPath);
+    }
+    Position position;
+    for (Move move: moves) {
+        if (!position.isLegal(move)) {
+            throw std::runtime_error("Illegal move: " + move.toString());
+        }
+        position.makeMove(move);
+    }
+    if (moves.size() > 0xFFFF) {
+        throw std::runtime_error("Game is too long.");
+    }
+
+    std::vector<char> record(RECORD_HEADER_SIZE + 2 * moves.size());
+    record[0] = static_cast<char>(moves.size() & 0xFF);
+    record[1] = static_cast<char>(moves.size() >> 8);
+    record[2] = static_cast<char>(winner);
+    for (std::size_t i = 0; i < moves.size(); i++) {
+        record[RECORD_HEADER_SIZE + 2 * i] = moves[i].from;
+        record[RECORD_HEADER_SIZE + 2 * i + 1] = moves[i].to;
+    }
+
+    std::uint64_t offset = getHeader().indexedBytes;
+    games.clear();
+    games.seekp(static_cast<std::streamoff>(offset));
+    games.write(record.data(), static_cast<std::streamsize>(record.size()));
+    games.flush();
+    if (!games) {
+        throw std::runtime_error("Unable to write " + gamesPath);
+    }
+
+    indexGame(offset, offset + record.size(), moves, winner);
+    return offset;
+}
+
+std::vector<Move> GameDatabase::readGame(std::uint64_t offset, Player &winner) {
+    std::vector<Move> moves;
+    std::uint64_t next;
+    if (!readRecord(offset, moves, winner, next) || !isPlayable(moves, winner)) {
+        throw std::runtime_error("Incorrect game offset.");
+    }
+    return moves;
+}
+
+bool GameDatabase::lookup(Position const &position, PositionStatistics &statistics) const {
+    if (!refreshIndex()) return false;
+    IndexSlot const *slot = findSlot(positionKey(position));
+    if (!slot) return false;
+
+    statistics.games = slot->games;
+    statistics.wins = slot->wins;
+    statistics.losses = slot->losses;
+    statistics.lastGame = slot->lastGame;
+    statistics.lastPly = slot->lastPly;
+    return true;
+}
+
+std::vector<ContinuationStatistics> GameDatabase::getContinuations(Position const &position) const {
+    std::vector<ContinuationStatistics> continuations;
+    if (!refreshIndex()) return continuations;
+    std::vector<std::uint64_t> seenKeys;
+    MoveList moveList;
+    position.generateMoves(moveList);
+
+    for (Move move: moveList) {
+        Position child = position;
+        child.makeMove(move);
+
+        //MOVES LEADING TO SYMMETRIC POSITIONS SHARE ONE ENTRY, ONLY THE FIRST OF THEM IS LISTED
+        std::uint64_t key = positionKey(child);
+        if (std::find(seenKeys.begin(), seenKeys.end(), key) != seenKeys.end()) continue;
+        seenKeys.push_back(key);
+
+        PositionStatistics statistics;
+        IndexSlot const *slot = findSlot(key);
+        if (!slot) continue;
+        statistics.games = slot->games;
+        statistics.wins = slot->wins;
+        statistics.losses = slot->losses;
+        statistics.lastGame = slot->lastGame;
+        statistics.lastPly = slot->lastPly;
+
+        //THE CHILD IS SEEN FROM THE OPPONENT'S SIDE. ITS COUNTS INCLUDE GAMES THAT REACHED IT BY ANOTHER ROUTE.
+        std::swap(statistics.wins, statistics.losses);
+        continuations.push_back({move, statistics});
+    }
+
+    std::sort(continuations.begin(), continuations.end(), [](auto const &first, auto const &second) {
+        return first.statistics.games > second.statistics.games;
+    });
+    return continuations;
+}
+
+std::uint64_t GameDatabase::getGameCount() const {
+    return refreshIndex() ? getHeader().games : 0;
+}
+
+GameDatabase::IndexHeader &GameDatabase::getHeader() const {
+    return *reinterpret_cast<IndexHeader *>(index.getData());
+}
+
+GameDatabase::IndexSlot *GameDatabase::getSlots() const {
+    return reinterpret_cast<IndexSlot *>(index.getData() + sizeof(IndexHeader));
+}
+
+bool GameDatabase::isValidIndex() const {
+    if (index.getSize() < sizeof(IndexHeader)) return false;
+    IndexHeader const &header = getHeader();
+    return std::memcmp(header.magic, GAME_INDEX_MAGIC, MAGIC_SIZE) == 0 && header.version == INDEX_VERSION &&
+           header.byteOrder == BYTE_ORDER_MARK && header.database == databaseId &&
+           sizeof(IndexHeader) + header.capacity * sizeof(IndexSlot) == index.getSize();
+}
+
+bool GameDatabase::refreshIndex() const {
+    if (access == DatabaseAccess::READ_WRITE || isValidIndex()) return true;
+
+    //THE WRITER RENAMED A NEW INDEX OVER THE ONE MAPPED HERE AND ZEROED ITS CAPACITY
+    try {
+        index.openReadOnly(indexPath);
+    } catch (std::runtime_error const &) {
+        return false;
+    }
+    return isValidIndex();
+}
+
+void GameDatabase::openIndex() {
+    if (std::filesystem::exists(indexPath) && std::filesystem::file_size(indexPath) > 0) {
+        index.open(indexPath, 0);
+        if (isValidIndex() && !getHeader().indexingGame) return;
+    }
+    replaceIndex(INITIAL_CAPACITY, {}, emptyHeader());
+}
+
+GameDatabase::IndexHeader GameDatabase::emptyHeader() const {
+    IndexHeader header{};
+    header.indexedBytes = DATABASE_HEADER_SIZE;
+    return header;
+}
+
+void GameDatabase::replaceIndex(std::uint64_t capacity, std::vector<IndexSlot> const &slots, IndexHeader header) {
+    //THE NEW TABLE IS BUILT IN A FILE OF ITS OWN AND RENAMED OVER games.hxi, SO A READER NEVER SEES ONE RESIZED OR
+    //HALF BUILT UNDER ITS MAPPING. IT ONLY HAS TO NOTICE THE OLD ONE WAS REPLACED.
+    std::string newPath = indexPath + ".new";
+    std::size_t size = sizeof(IndexHeader) + capacity * sizeof(IndexSlot);
+    std::filesystem::remove(newPath);
+    {
+        std::memcpy(header.magic, GAME_INDEX_MAGIC, MAGIC_SIZE);
+        header.version = INDEX_VERSION;
+        header.byteOrder = BYTE_ORDER_MARK;
+        header.database = databaseId;
+        header.capacity = capacity;
+        header.used = 0;
+
+        MappedFile fresh;
+        fresh.open(newPath, size);
+        auto *table = reinterpret_cast<IndexSlot *>(fresh.getData() + sizeof(IndexHeader));
+        std::uint64_t mask = capacity - 1;
+        for (auto const &slot: slots) {
+            if (!slot.key) continue;
+            std::uint64_t i = slot.key & mask;
+            while (table[i].key) i = (i + 1) & mask;
+            table[i] = slot;
+            header.used++;
+        }
+        std::memcpy(fresh.getData(), &header, sizeof(IndexHeader));
+    }
+    std::filesystem::rename(newPath, indexPath);
+
+    if (index.getSize() >= sizeof(IndexHeader)) {
+        getHeader().capacity = 0;
+    }
+    index.open(indexPath, size);
+}
+
+void GameDatabase::growIndex() {
+    IndexHeader header = getHeader();
+    std::vector<IndexSlot> slots(getSlots(), getSlots() + header.capacity);
+    replaceIndex(header.capacity * 2, slots, header);
+}
+
+void GameDatabase::catchUp() {
+    games.clear();
+    games.seekg(0, std::ios::end);
+    std::uint64_t end = static_cast<std::uint64_t>(games.tellg());
+
+    std::vector<Move> moves;
+    Player winner;
+    std::uint64_t offset = getHeader().indexedBytes, next;
+    if (offset > end) {
+        replaceIndex(getHeader().capacity, {}, emptyHeader());
+        offset = DATABASE_HEADER_SIZE;
+    }
+
+    while (offset < end && readRecord(offset, moves, winner, next)) {
+        //A COMPLETE RECORD THAT IS NOT A LEGAL GAME IS CORRUPT OR FOREIGN DATA. INDEXING STOPS IN FRONT OF IT AND
+        //THE FILE IS LEFT ALONE, addGame REFUSES TO WRITE OVER IT.
+        if (!isPlayable(moves, winner)) {
+            damagedRecord = offset;
+            return;
+        }
+        indexGame(offset, next, moves, winner);
+        offset = next;
+    }
+
+    //A RECORD CUT SHORT BY A CRASH IS DROPPED SO THE NEXT GAME IS APPENDED AFTER THE LAST COMPLETE ONE
+    if (offset < end) {
+        games.close();
+        std::filesystem::resize_file(gamesPath, offset);
+        games.open(gamesPath, std::ios::in | std::ios::out | std::ios::binary);
+    }
+}
+
+bool GameDatabase::readRecord(std::uint64_t offset, std::vector<Move> &moves, Player &winner, std::uint64_t &next) {
+    std::array<unsigned char, RECORD_HEADER_SIZE> header{};
+    games.clear();
+    games.seekg(static_cast<std::streamoff>(offset));
+    if (!games.read(reinterpret_cast<char *>(header.data()), RECORD_HEADER_SIZE)) return false;
+
+    std::size_t count = header[0] | header[1] << 8;
+    std::vector<unsigned char> bytes(2 * count);
+    if (!games.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()))) return false;
+
+    moves.resize(count);
+    for (std::size_t i = 0; i < count; i++) {
+        moves[i] = {static_cast<std::int8_t>(bytes[2 * i]), static_cast<std::int8_t>(bytes[2 * i + 1])};
+    }
+    winner = static_cast<Player>(header[2]);
+    next = offset + RECORD_HEADER_SIZE + bytes.size();
+    return true;
+}
+
+bool GameDatabase::isPlayable(std::vector<Move> const &moves, Player winner) {
+    if (static_cast<int>(winner) > 2) return false;
+
+    //FROM AND TO ARE RAW BYTES, isLegal REJECTS CELLS OFF THE BOARD BEFORE makeMove TOUCHES ANY TABLE
+    Position position;
+    for (Move move: moves) {
+        if (!position.isLegal(move)) return false;
+        position.makeMove(move);
+    }
+    return true;
+}
+
+void GameDatabase::indexGame(std::uint64_t offset, std::uint64_t next, std::vector<Move> const &moves,
+                             Player winner) {
+    getHeader().indexingGame = offset;
+    Position position;
+    std::vector<std::uint64_t> seenKeys;
+    for (std::size_t ply = 0; ply <= moves.size(); ply++) {
+        //KEEP THE TABLE AT MOST 70% FULL SO PROBES STAY SHORT
+        if ((getHeader().used + 1) * 10 > getHeader().capacity * 7) {
+            growIndex();
+        }
+
+        //A POSITION REACHED AGAIN IN THE SAME GAME IS COUNTED ONCE, AT ITS FIRST PLY
+        std::uint64_t key = positionKey(position);
+        if (std::find(seenKeys.begin(), seenKeys.end(), key) != seenKeys.end()) {
+            if (ply < moves.size()) position.makeMove(moves[ply]);
+            continue;
+        }
+        seenKeys.push_back(key);
+
+        std::uint64_t mask = getHeader().capacity - 1;
+        IndexSlot *slots = getSlots();
+        std::uint64_t i = key & mask;
+        while (slots[i].key && slots[i].key != key) i = (i + 1) & mask;
+
+        IndexSlot &slot = slots[i];
+        if (!slot.key) {
+            slot.key = key;
+            getHeader().used++;
+        }
+        slot.games++;
+        if (winner == position.getSideToMove()) slot.wins++;
+        else if (winner != Player::NO_PLAYER) slot.losses++;
+        slot.lastGame = offset;
+        slot.lastPly = static_cast<std::uint32_t>(ply);
+
+        if (ply < moves.size()) position.makeMove(moves[ply]);
+    }
+    getHeader().games++;
+    getHeader().indexedBytes = next;
+    getHeader().indexingGame = 0;
+}
+
+GameDatabase::IndexSlot const *GameDatabase::findSlot(std::uint64_t key) const {
+    //THE MASK COMES FROM THE MAPPING, NOT THE HEADER, WHICH THE WRITER MAY ZERO WHILE A READER PROBES
+    std::uint64_t mask = (index.getSize() - sizeof(IndexHeader)) / sizeof(IndexSlot) - 1;
+    IndexSlot const *slots = getSlots();
+    for (std::uint64_t i = key & mask; slots[i].key; i = (i + 1) & mask) {
+        if (slots[i].key == key) return &slots[i];
+    }
+    return nullptr;
+}
+
+std::uint64_t GameDatabase::positionKey(Position const &position) {
+    //SYMMETRIC POSITIONS SHARE ONE ENTRY, 0 MARKS AN EMPTY SLOT
+    std::uint64_t key = canonicalKey(position).key;
+    return key ? key : 1;
+}
@@ -1,7 +1,21 @@
 #include "headers/Hexagon.hpp"
 #include <cmath>
 
-Hexagon::Hexagon(float x, float y, float size, sf::RenderWindow &window) : window(window) {
+namespace {
+    constexpr float PIECE_RADIUS = 0.6f;
+
+    sf::Color getPlayerColor(Player player) {
+        if (player == Player::PLAYER_A) return sf::Color::Red;
+        if (player == Player::PLAYER_B) return sf::Color::Blue;
+        return sf::Color::Transparent;
+    }
+
+    sf::Uint8 mix(sf::Uint8 from, sf::Uint8 to, float blend) {
+        return static_cast<sf::Uint8>(from + (to - from) * blend);
+    }
+}
+
+Hexagon::Hexagon(float x, float y, float size) : x(x), y(y), size(size), pieceAnimated(false) {
     //https://stackoverflow.com/questions/37236439/creating-a-single-hexagon-in-c-sharp-using-drawpolygon
     //https://www.sfml-dev.org/tutorials/2.0/graphics-shape.php
     shape.setPointCount(6);
@@ -14,17 +28,44 @@ Hexagon::Hexagon(float x, float y, float size, sf::RenderWindow &window) : windo
     shape.setOutlineThickness(3.0f);
     shape.setOutlineColor(sf::Color::Black);
 
-    circle.setRadius(size * 0.6f);
-    circle.setPosition(x - size * 0.6f, y - size * 0.6f);
+    circle.setRadius(size * PIECE_RADIUS);
+    circle.setPosition(x - size * PIECE_RADIUS, y - size * PIECE_RADIUS);
     circle.setFillColor(sf::Color::Transparent);
 
     setOwner(Player::NO_PLAYER);
     setState(HexagonState::DEFAULT);
 }
 
-void Hexagon::draw() {
-    window.draw(shape);
-    window.draw(circle);
+void Hexagon::draw(sf::RenderTarget &target) {
+    target.draw(shape);
+    if (!pieceAnimated) {
+        target.draw(circle);
+    }
+}
+
+void Hexagon::drawPiece(sf::RenderTarget &target) {
+    target.draw(circle);
+}
+
+void Hexagon::animatePiece(Player from, Player to, float blend, float scale, sf::Vector2f center) {
+    pieceAnimated = true;
+    float radius = size * PIECE_RADIUS * scale;
+    circle.setRadius(radius);
+    circle.setPosition(center.x - radius, center.y - radius);
+
+    sf::Color fromColor = getPlayerColor(from), toColor = getPlayerColor(to);
+    //AN EMPTY SIDE ONLY FADES THE OTHER COLOUR IN OR OUT
+    if (from == Player::NO_PLAYER) fromColor = sf::Color(toColor.r, toColor.g, toColor.b, 0);
+    if (to == Player::NO_PLAYER) toColor = sf::Color(fromColor.r, fromColor.g, fromColor.b, 0);
+    circle.setFillColor(sf::Color(mix(fromColor.r, toColor.r, blend), mix(fromColor.g, toColor.g, blend),
+                                  mix(fromColor.b, toColor.b, blend), mix(fromColor.a, toColor.a, blend)));
+}
+
+void Hexagon::stopAnimation() {
+    pieceAnimated = false;
+    circle.setRadius(size * PIECE_RADIUS);
+    circle.setPosition(x - size * PIECE_RADIUS, y - size * PIECE_RADIUS);
+    setOwner(owner);
 }
 
 bool Hexagon::containsCoordinates(float mouseX, float mouseY) const {
@@ -38,10 +79,18 @@ void Hexagon::setState(HexagonState state) {
     if (state == HexagonState::DEFAULT) setFieldColor(sf::Color::White);
 }
 
+sf::Vector2f Hexagon::getCenter() const {
+    return {x, y};
+}
+
 HexagonState Hexagon::getState() {
     return currentState;
 }
 
+void Hexagon::setHighlighted(bool highlighted) {
+    shape.setOutlineColor(highlighted ? sf::Color::Cyan : sf::Color::Black);
+}
+
 bool Hexagon::belongsToEnemy(Player currentPlayer) {
     return getOwner() != Player::NO_PLAYER &&
            getOwner() != currentPlayer;
@@ -60,9 +109,7 @@ void Hexagon::applyAdjacentHexagonsMode(AdjacentHexagonsMode mode, Player curren
 
 void Hexagon::setOwner(Player newOwner) {
     owner = newOwner;
-    if (newOwner == Player::PLAYER_A) setCircleColor(sf::Color::Red);
-    if (newOwner == Player::PLAYER_B) setCircleColor(sf::Color::Blue);
-    if (newOwner == Player::NO_PLAYER) setCircleColor(sf::Color::Transparent);
+    setCircleColor(getPlayerColor(newOwner));
 }
 
 Player Hexagon::getOwner() {
@@ -85,6 +132,7 @@ void swap(Hexagon &first, Hexagon &second) {
     swap(first.size, second.size);
     swap(first.owner, second.owner);
     swap(first.currentState, second.currentState);
+    swap(first.pieceAnimated, second.pieceAnimated);
     swap(first.shape, second.shape);
     swap(first.circle, second.circle);
 }
\ No newline at end of file
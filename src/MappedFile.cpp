@@ -0,0 +1,143 @@
+#include "headers/MappedFile.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+MappedFile::MappedFile() : data(nullptr), size(0), file(INVALID_HANDLE_VALUE), mapping(nullptr) {}
+
+void MappedFile::open(std::string const &path, std::size_t newSize) {
+    close();
+    file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr,
+                       OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    LARGE_INTEGER currentSize;
+    GetFileSizeEx(file, &currentSize);
+    size = std::max<std::size_t>(newSize, static_cast<std::size_t>(currentSize.QuadPart));
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(std::uint64_t(size) >> 32),
+                                 static_cast<DWORD>(size), nullptr);
+    data = mapping ? static_cast<unsigned char *>(MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size)) : nullptr;
+    if (!data) {
+        close();
+        throw std::runtime_error("Unable to map " + path);
+    }
+}
+
+void MappedFile::openReadOnly(std::string const &path) {
+    close();
+    file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                       OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    LARGE_INTEGER currentSize{};
+    if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &currentSize) || currentSize.QuadPart == 0) {
+        close();
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    size = static_cast<std::size_t>(currentSize.QuadPart);
+    mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    data = mapping ? static_cast<unsigned char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size)) : nullptr;
+    if (!data) {
+        close();
+        throw std::runtime_error("Unable to map " + path);
+    }
+}
+
+void MappedFile::close() {
+    if (data) UnmapViewOfFile(data);
+    if (mapping) CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+    data = nullptr;
+    mapping = nullptr;
+    file = INVALID_HANDLE_VALUE;
+    size = 0;
+}
+
+void MappedFile::flush() {
+    if (data) FlushViewOfFile(data, size);
+}
+
+#else
+
+MappedFile::MappedFile() : data(nullptr), size(0), fd(-1) {}
+
+void MappedFile::open(std::string const &path, std::size_t newSize) {
+    close();
+    fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    struct stat status{};
+    if (fd < 0 || fstat(fd, &status) < 0) {
+        close();
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    size = std::max<std::size_t>(newSize, static_cast<std::size_t>(status.st_size));
+    if (static_cast<std::size_t>(status.st_size) < size && ftruncate(fd, static_cast<off_t>(size)) < 0) {
+        close();
+        throw std::runtime_error("Unable to resize " + path);
+    }
+
+    void *address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        close();
+        throw std::runtime_error("Unable to map " + path);
+    }
+    data = static_cast<unsigned char *>(address);
+}
+
+void MappedFile::openReadOnly(std::string const &path) {
+    close();
+    fd = ::open(path.c_str(), O_RDONLY);
+    struct stat status{};
+    if (fd < 0 || fstat(fd, &status) < 0 || status.st_size == 0) {
+        close();
+        throw std::runtime_error("Unable to open " + path);
+    }
+
+    size = static_cast<std::size_t>(status.st_size);
+    void *address = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+        close();
+        throw std::runtime_error("Unable to map " + path);
+    }
+    data = static_cast<unsigned char *>(address);
+}
+
+void MappedFile::close() {
+    if (data) munmap(data, size);
+    if (fd >= 0) ::close(fd);
+    data = nullptr;
+    fd = -1;
+    size = 0;
+}
+
+void MappedFile::flush() {
+    if (data) msync(data, size, MS_ASYNC);
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+unsigned char *MappedFile::getData() const {
+    return data;
+}
+
+std::size_t MappedFile::getSize() const {
+    return size;
+}
@@ -0,0 +1,474 @@
+#include "headers/MatchServer.hpp"
+#include "headers/Evaluation.hpp"
+#include <fmt/format.h>
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sstream>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+    constexpr int MAX_EVENTS = 256;
+    constexpr int MAX_TIMEOUT_MILLISECONDS = 250;
+    constexpr std::uint64_t LISTENER_DATA = ~std::uint64_t(0);
+
+    void makeNonBlocking(int fd) {
+        int flags = fcntl(fd, F_GETFL, 0);
+        if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+            throw std::runtime_error(std::string("fcntl: ") + std::strerror(errno));
+        }
+    }
+
+    char sideName(int side) {
+        return side == 0 ? 'A' : 'B';
+    }
+}
+
+MatchServer::MatchServer(ServerOptions const &options, std::ostream &log)
+        : options(options), log(log), listenFd(-1), epollFd(-1), running(false),
+          nextGameId(1), totalMoves(0), finishedGames(0) {
+    epollFd = epoll_create1(0);
+    if (epollFd < 0) {
+        throw std::runtime_error(std::string("epoll_create1: ") + std::strerror(errno));
+    }
+    openListener();
+    if (!options.databasePath.empty()) {
+        database = std::make_unique<GameDatabase>(options.databasePath);
+    }
+}
+
+MatchServer::~MatchServer() {
+    for (auto &connection: connections) {
+        if (connection.fd >= 0) close(connection.fd);
+    }
+    if (listenFd >= 0) close(listenFd);
+    if (epollFd >= 0) close(epollFd);
+    if (!options.unixSocketPath.empty()) unlink(options.unixSocketPath.c_str());
+}
+
+void MatchServer::openListener() {
+    if (!options.unixSocketPath.empty()) {
+        sockaddr_un address{};
+        if (options.unixSocketPath.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("Socket path is too long: " + options.unixSocketPath);
+        }
+        address.sun_family = AF_UNIX;
+        std::strcpy(address.sun_path, options.unixSocketPath.c_str());
+        unlink(address.sun_path);
+
+        listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listenFd < 0 || bind(listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+            throw std::runtime_error("Cannot bind " + options.unixSocketPath + ": " + std::strerror(errno));
+        }
+    } else {
+        //ONLY LOCALHOST - THE PROTOCOL HAS NO AUTHENTICATION
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<std::uint16_t>(options.port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        listenFd = socket(AF_INET, SOCK_STREAM, 0);
+        int enable = 1;
+        if (listenFd < 0 || setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) < 0 ||
+            bind(listenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) < 0) {
+            throw std::runtime_error(fmt::format("Cannot bind 127.0.0.1:{}: {}", options.port, std::strerror(errno)));
+        }
+    }
+
+    if (listen(listenFd, SOMAXCONN) < 0) {
+        throw std::runtime_error(std::string("listen: ") + std::strerror(errno));
+    }
+    makeNonBlocking(listenFd);
+
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = LISTENER_DATA;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &event);
+}
+
+void MatchServer::run() {
+    std::array<epoll_event, MAX_EVENTS> events{};
+    auto lastReport = Clock::now();
+    std::uint64_t lastMoves = 0;
+    running = true;
+
+    while (running) {
+        int count = epoll_wait(epollFd, events.data(), MAX_EVENTS, nextTimeout());
+        if (count < 0 && errno != EINTR) {
+            throw std::runtime_error(std::string("epoll_wait: ") + std::strerror(errno));
+        }
+
+        for (int i = 0; i < count; i++) {
+            std::uint64_t data = events[i].data.u64;
+            if (data == LISTENER_DATA) {
+                acceptConnections();
+                continue;
+            }
+
+            //STALE EVENTS FOR A SLOT THAT WAS CLOSED AND REUSED IN THIS BATCH ARE DROPPED BY THE GENERATION CHECK
+            int slot = static_cast<int>(data & 0xFFFFFFFF);
+            if (connections[slot].fd < 0 || connections[slot].generation != data >> 32) continue;
+
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                closeConnection(slot);
+                continue;
+            }
+            if (events[i].events & EPOLLOUT) writeConnection(slot);
+            if (connections[slot].fd >= 0 && (events[i].events & EPOLLIN)) readConnection(slot);
+        }
+
+        expireDeadlines();
+
+        auto now = Clock::now();
+        if (now - lastReport >= std::chrono::seconds(10)) {
+            double seconds = std::chrono::duration<double>(now - lastReport).count();
+            log << fmt::format(R"({{"event":"status","connections":{},"games":{},"finished":{},)"
+                               R"("moves_per_second":{:.0f}}})",
+                               connections.size() - freeConnections.size(), games.size() - freeGames.size(),
+                               finishedGames, static_cast<double>(totalMoves - lastMoves) / seconds) << std::endl;
+            lastReport = now;
+            lastMoves = totalMoves;
+        }
+    }
+}
+
+void MatchServer::stop() {
+    running = false;
+}
+
+void MatchServer::acceptConnections() {
+    while (true) {
+        int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK);
+        if (fd < 0) return;
+
+        if (static_cast<int>(connections.size() - freeConnections.size()) >= options.maxConnections) {
+            close(fd);
+            continue;
+        }
+        if (options.unixSocketPath.empty()) {
+            int enable = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        }
+
+        int slot;
+        if (freeConnections.empty()) {
+            slot = static_cast<int>(connections.size());
+            connections.emplace_back();
+        } else {
+            slot = freeConnections.back();
+            freeConnections.pop_back();
+        }
+
+        Connection &connection = connections[slot];
+        std::uint32_t generation = connection.generation + 1;
+        connection = Connection();
+        connection.fd = fd;
+        connection.generation = generation;
+        connection.output.reserve(MAX_OUTPUT_SIZE);
+
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = eventData(slot);
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+
+        send(slot, "hello hexxagon 1");
+    }
+}
+
+void MatchServer::readConnection(int slot) {
+    while (connections[slot].fd >= 0) {
+        Connection &connection = connections[slot];
+        ssize_t received = recv(connection.fd, connection.input.data() + connection.inputSize,
+                                MAX_LINE_LENGTH - connection.inputSize, 0);
+        if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+        if (received <= 0) {
+            closeConnection(slot);
+            return;
+        }
+        connection.inputSize += static_cast<std::size_t>(received);
+
+        std::size_t lineStart = 0;
+        for (std::size_t i = 0; i < connection.inputSize; i++) {
+            if (connection.input[i] != '\n') continue;
+            std::size_t lineEnd = i > lineStart && connection.input[i - 1] == '\r' ? i - 1 : i;
+            handleLine(slot, std::string(connection.input.data() + lineStart, lineEnd - lineStart));
+            if (connections[slot].fd < 0) return;
+            lineStart = i + 1;
+        }
+
+        std::memmove(connection.input.data(), connection.input.data() + lineStart, connection.inputSize - lineStart);
+        connection.inputSize -= lineStart;
+        if (connection.inputSize == MAX_LINE_LENGTH) {
+            send(slot, "error line too long");
+            closeConnection(slot);
+            return;
+        }
+    }
+}
+
+void MatchServer::writeConnection(int slot) {
+    Connection &connection = connections[slot];
+    while (connection.outputOffset < connection.output.size()) {
+        ssize_t sent = ::send(connection.fd, connection.output.data() + connection.outputOffset,
+                              connection.output.size() - connection.outputOffset, MSG_NOSIGNAL);
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+        if (sent <= 0) {
+            closeConnection(slot);
+            return;
+        }
+        connection.outputOffset += static_cast<std::size_t>(sent);
+    }
+
+    bool drained = connection.outputOffset == connection.output.size();
+    if (drained) {
+        connection.output.clear();
+        connection.outputOffset = 0;
+    }
+
+    //ONLY ASK FOR EPOLLOUT WHILE THERE IS SOMETHING LEFT TO FLUSH
+    if (drained == connection.flushing) {
+        connection.flushing = !drained;
+        epoll_event event{};
+        event.events = drained ? EPOLLIN : EPOLLIN | EPOLLOUT;
+        event.data.u64 = eventData(slot);
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, connection.fd, &event);
+    }
+}
+
+void MatchServer::closeConnection(int slot) {
+    Connection &connection = connections[slot];
+    if (connection.fd < 0) return;
+
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+    close(connection.fd);
+    connection.fd = -1;
+    connection.output = std::string();
+    freeConnections.push_back(slot);
+
+    if (connection.seeking) {
+        seekers.erase(connection.timeControl);
+        connection.seeking = false;
+    }
+    if (connection.game >= 0) {
+        finishGame(connection.game, games[connection.game].players[0] == slot ? 1 : 0, "disconnect");
+    }
+}
+
+void MatchServer::handleLine(int slot, std::string const &line) {
+    std::istringstream stream(line);
+    std::string command;
+    stream >> command;
+
+    if (command == "seek") {
+        std::int64_t baseMilliseconds = 60000, incrementMilliseconds = 0;
+        stream >> baseMilliseconds >> incrementMilliseconds;
+        if (baseMilliseconds <= 0 || incrementMilliseconds < 0) {
+            send(slot, "error invalid time control");
+            return;
+        }
+        seek(slot, baseMilliseconds, incrementMilliseconds);
+    } else if (command == "move") {
+        std::string move;
+        stream >> move;
+        playMove(slot, move);
+    } else if (command == "resign") {
+        int game = connections[slot].game;
+        if (game < 0) {
+            send(slot, "error not in a game");
+            return;
+        }
+        finishGame(game, games[game].players[0] == slot ? 1 : 0, "resign");
+    } else if (command == "quit") {
+        closeConnection(slot);
+    } else if (!command.empty()) {
+        send(slot, "error unknown command " + command);
+    }
+}
+
+void MatchServer::seek(int slot, std::int64_t baseMilliseconds, std::int64_t incrementMilliseconds) {
+    Connection &connection = connections[slot];
+    if (connection.game >= 0 || connection.seeking) {
+        send(slot, "error already playing or seeking");
+        return;
+    }
+
+    std::pair timeControl{baseMilliseconds, incrementMilliseconds};
+    auto waiting = seekers.find(timeControl);
+    if (waiting == seekers.end()) {
+        seekers.emplace(timeControl, slot);
+        connection.seeking = true;
+        connection.timeControl = timeControl;
+        return;
+    }
+
+    int opponent = waiting->second;
+    seekers.erase(waiting);
+    connections[opponent].seeking = false;
+    startGame(opponent, slot, baseMilliseconds, incrementMilliseconds);
+}
+
+void MatchServer::startGame(int first, int second, std::int64_t baseMilliseconds, std::int64_t incrementMilliseconds) {
+    int slot;
+    if (freeGames.empty()) {
+        slot = static_cast<int>(games.size());
+        games.emplace_back();
+    } else {
+        slot = freeGames.back();
+        freeGames.pop_back();
+    }
+
+    ServerGame &game = games[slot];
+    game = ServerGame();
+    game.players = {first, second};
+    game.clockMilliseconds = {baseMilliseconds, baseMilliseconds};
+    game.incrementMilliseconds = incrementMilliseconds;
+    game.turnStart = Clock::now();
+    game.id = nextGameId++;
+    game.active = true;
+    connections[first].game = slot;
+    connections[second].game = slot;
+
+    std::string position = game.position.toString();
+    for (int side = 0; side < 2 && game.active; side++) {
+        send(game.players[side], fmt::format("start {} {} {} {} {}", game.id, sideName(side), baseMilliseconds,
+                                             incrementMilliseconds, position));
+    }
+    deadlines.push({game.turnStart + std::chrono::milliseconds(baseMilliseconds), slot, game.id, 0});
+}
+
+void MatchServer::playMove(int slot, std::string const &text) {
+    int gameSlot = connections[slot].game;
+    if (gameSlot < 0) {
+        send(slot, "error not in a game");
+        return;
+    }
+
+    ServerGame &game = games[gameSlot];
+    int side = game.players[0] == slot ? 0 : 1;
+    if (side != (game.position.getSideToMove() == Player::PLAYER_A ? 0 : 1)) {
+        send(slot, "error not your turn");
+        return;
+    }
+
+    auto now = Clock::now();
+    game.clockMilliseconds[side] -= std::chrono::duration_cast<std::chrono::milliseconds>(now - game.turnStart).count();
+    if (game.clockMilliseconds[side] < 0) {
+        finishGame(gameSlot, 1 - side, "time");
+        return;
+    }
+
+    Move move;
+    try {
+        move = game.position.parseMove(text);
+    } catch (std::runtime_error const &) {
+        finishGame(gameSlot, 1 - side, "illegal");
+        return;
+    }
+
+    game.position.makeMove(move);
+    histories.append(game.history, move);
+    game.clockMilliseconds[side] += game.incrementMilliseconds;
+    game.turnStart = now;
+    totalMoves++;
+
+    std::string line = fmt::format("moved {} {} {}", move.toString(), game.clockMilliseconds[0],
+                                   game.clockMilliseconds[1]);
+    send(game.players[0], line);
+    if (game.active) send(game.players[1], line);
+    if (!game.active) return;
+
+    if (isTerminal(game.position)) {
+        int difference = finalPointsDifference(game.position);
+        int mover = game.position.getSideToMove() == Player::PLAYER_A ? 0 : 1;
+        finishGame(gameSlot, difference == 0 ? -1 : difference > 0 ? mover : 1 - mover, "points");
+        return;
+    }
+
+    int next = 1 - side;
+    deadlines.push({now + std::chrono::milliseconds(game.clockMilliseconds[next]), gameSlot, game.id,
+                    game.history.size});
+}
+
+void MatchServer::finishGame(int gameSlot, int winner, std::string const &reason) {
+    ServerGame &game = games[gameSlot];
+    if (!game.active) return;
+
+    int pointsA = game.position.getPoints(Player::PLAYER_A);
+    int pointsB = game.position.getPoints(Player::PLAYER_B);
+    if (reason == "points" && !game.position.isGameOver()) {
+        //A PLAYER WHO CANNOT MOVE ENDS THE GAME AND THE OPPONENT TAKES ALL EMPTY FIELDS
+        int empty = CELL_COUNT - pointsA - pointsB;
+        if (game.position.getSideToMove() == Player::PLAYER_A) pointsB += empty;
+        else pointsA += empty;
+    }
+
+    //RELEASE THE GAME BEFORE SENDING - A FAILED SEND CLOSES THE CONNECTION AND MUST NOT FINISH IT TWICE
+    game.active = false;
+    freeGames.push_back(gameSlot);
+    finishedGames++;
+    for (int player: game.players) {
+        connections[player].game = -1;
+    }
+
+    std::string result = winner < 0 ? "draw" : std::string(1, sideName(winner));
+    if (options.logGames) {
+        log << fmt::format(R"({{"event":"game","id":{},"result":"{}","points_a":{},"points_b":{},"reason":"{}",)"
+                           R"("plies":{},"moves":"{}"}})",
+                           game.id, result, pointsA, pointsB, reason, game.history.size,
+                           histories.toString(game.history)) << '\n';
+    }
+    if (database) {
+        database->addGame(histories.toVector(game.history),
+                          winner < 0 ? Player::NO_PLAYER : winner == 0 ? Player::PLAYER_A : Player::PLAYER_B);
+    }
+    histories.release(game.history);
+
+    std::string line = fmt::format("result {} {} {} {}", result, pointsA, pointsB, reason);
+    for (int player: game.players) {
+        if (connections[player].fd >= 0) send(player, line);
+    }
+}
+
+void MatchServer::expireDeadlines() {
+    auto now = Clock::now();
+    while (!deadlines.empty() && deadlines.top().time <= now) {
+        Deadline deadline = deadlines.top();
+        deadlines.pop();
+
+        //A DEADLINE IS STALE ONCE ITS GAME ENDED OR THE PLAYER ON TURN MOVED
+        ServerGame &game = games[deadline.game];
+        if (!game.active || game.id != deadline.id || game.history.size != deadline.plies) continue;
+        int side = game.position.getSideToMove() == Player::PLAYER_A ? 0 : 1;
+        finishGame(deadline.game, 1 - side, "time");
+    }
+}
+
+int MatchServer::nextTimeout() const {
+    if (deadlines.empty()) return MAX_TIMEOUT_MILLISECONDS;
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadlines.top().time - Clock::now()).count();
+    return static_cast<int>(std::clamp<std::int64_t>(remaining + 1, 0, MAX_TIMEOUT_MILLISECONDS));
+}
+
+void MatchServer::send(int slot, std::string const &line) {
+    Connection &connection = connections[slot];
+    if (connection.output.size() + line.size() + 1 > MAX_OUTPUT_SIZE) {
+        //THE CLIENT STOPPED READING, DROP IT INSTEAD OF BUFFERING WITHOUT BOUND
+        closeConnection(slot);
+        return;
+    }
+    connection.output += line;
+    connection.output += '\n';
+    writeConnection(slot);
+}
+
+std::uint64_t MatchServer::eventData(int slot) const {
+    return static_cast<std::uint64_t>(connections[slot].generation) << 32 | static_cast<std::uint32_t>(slot);
+}
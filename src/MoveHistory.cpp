@@ -0,0 +1,81 @@
+#include "headers/MoveHistory.hpp"
+#include <stdexcept>
+
+MoveHistoryPool::MoveHistoryPool(std::size_t reservedBlocks) : freeBlocks(NO_MOVE_BLOCK), freeBlockCount(0) {
+    blocks.reserve(reservedBlocks);
+}
+
+void MoveHistoryPool::append(MoveHistory &history, Move move) {
+    std::uint32_t offset = history.size % MOVE_BLOCK_CAPACITY;
+    if (history.size == 0 || offset == 0) {
+        std::uint32_t block = allocate();
+        if (history.size == 0) history.first = block;
+        else blocks[history.last].next = block;
+        history.last = block;
+    }
+    blocks[history.last].moves[offset] = move;
+    history.size++;
+}
+
+Move MoveHistoryPool::get(MoveHistory const &history, std::uint32_t index) const {
+    if (index >= history.size) {
+        throw std::runtime_error("Move index out of range.");
+    }
+    std::uint32_t block = history.first;
+    for (std::uint32_t skipped = index / MOVE_BLOCK_CAPACITY; skipped > 0; skipped--) {
+        block = blocks[block].next;
+    }
+    return blocks[block].moves[index % MOVE_BLOCK_CAPACITY];
+}
+
+std::vector<Move> MoveHistoryPool::toVector(MoveHistory const &history) const {
+    std::vector<Move> moves;
+    moves.reserve(history.size);
+    std::uint32_t block = history.first;
+    for (std::uint32_t index = 0; index < history.size; index++) {
+        if (index > 0 && index % MOVE_BLOCK_CAPACITY == 0) block = blocks[block].next;
+        moves.push_back(blocks[block].moves[index % MOVE_BLOCK_CAPACITY]);
+    }
+    return moves;
+}
+
+std::string MoveHistoryPool::toString(MoveHistory const &history) const {
+    std::string text;
+    for (Move move: toVector(history)) {
+        if (!text.empty()) text += ' ';
+        text += move.toString();
+    }
+    return text;
+}
+
+void MoveHistoryPool::release(MoveHistory &history) {
+    if (history.size > 0) {
+        //THE WHOLE CHAIN IS SPLICED ONTO THE FREE LIST AT ONCE
+        blocks[history.last].next = freeBlocks;
+        freeBlocks = history.first;
+        freeBlockCount += (history.size + MOVE_BLOCK_CAPACITY - 1) / MOVE_BLOCK_CAPACITY;
+    }
+    history = MoveHistory();
+}
+
+std::size_t MoveHistoryPool::getBlockCount() const {
+    return blocks.size();
+}
+
+std::size_t MoveHistoryPool::getFreeBlockCount() const {
+    return freeBlockCount;
+}
+
+std::uint32_t MoveHistoryPool::allocate() {
+    std::uint32_t block;
+    if (freeBlocks != NO_MOVE_BLOCK) {
+        block = freeBlocks;
+        freeBlocks = blocks[block].next;
+        freeBlockCount--;
+    } else {
+        block = static_cast<std::uint32_t>(blocks.size());
+        blocks.emplace_back();
+    }
+    blocks[block].next = NO_MOVE_BLOCK;
+    return block;
+}
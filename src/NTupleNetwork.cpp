@@ -0,0 +1,194 @@
+#include "headers/NTupleNetwork.hpp"
+#include "headers/Evaluation.hpp"
+#include "headers/Symmetry.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+
+namespace {
+    constexpr std::array<int, NTUPLE_LENGTH> makePowersOfThree() {
+        std::array<int, NTUPLE_LENGTH> powers{};
+        int power = 1;
+        for (auto &value: powers) {
+            value = power;
+            power *= 3;
+        }
+        return powers;
+    }
+
+    constexpr std::array<int, NTUPLE_LENGTH> POWERS_OF_THREE = makePowersOfThree();
+
+    std::unique_ptr<NTupleNetwork> evaluationNetwork;
+
+    void writeUnsigned(std::ostream &output, std::uint32_t value) {
+        for (int i = 0; i < 4; i++) {
+            output.put(static_cast<char>(value >> (8 * i)));
+        }
+    }
+
+    std::uint32_t readUnsigned(std::istream &input) {
+        std::uint32_t value = 0;
+        for (int i = 0; i < 4; i++) {
+            value |= static_cast<std::uint32_t>(static_cast<unsigned char>(input.get())) << (8 * i);
+        }
+        return value;
+    }
+}
+
+NTupleNetwork::NTupleNetwork() {
+    int tableCount = 0;
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        //ONE TABLE PER ORBIT, BUILT FROM THE LOWEST CELL OF THE ORBIT
+        bool representative = std::all_of(SYMMETRIES.begin(), SYMMETRIES.end(),
+                                          [&](CellPermutation const &symmetry) { return symmetry[cell] >= cell; });
+        if (!representative) continue;
+
+        std::array<int, NTUPLE_LENGTH> flower{};
+        auto center = toCube(cell);
+        flower[0] = cell;
+        for (int direction = 0; direction < 6; direction++) {
+            flower[direction + 1] = fromCube({center.x + CUBE_DIRECTIONS[direction].x,
+                                              center.y + CUBE_DIRECTIONS[direction].y,
+                                              center.z + CUBE_DIRECTIONS[direction].z});
+        }
+
+        int firstTuple = static_cast<int>(tuples.size());
+        for (auto const &symmetry: SYMMETRIES) {
+            NTuple tuple{{}, tableCount * NTUPLE_TABLE_SIZE};
+            for (int i = 0; i < NTUPLE_LENGTH; i++) {
+                tuple.cells[i] = flower[i] < 0 ? -1 : symmetry[flower[i]];
+            }
+            bool duplicate = std::any_of(tuples.begin() + firstTuple, tuples.end(),
+                                         [&](NTuple const &other) { return other.cells == tuple.cells; });
+            if (!duplicate) {
+                tuples.push_back(tuple);
+            }
+        }
+        tableCount++;
+    }
+    weights.assign(tableCount * NTUPLE_TABLE_SIZE, 0);
+    widenedWeights.assign(weights.size(), 0);
+}
+
+void NTupleNetwork::load(std::string const &fileName) {
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open " + fileName);
+    }
+
+    char magic[4];
+    file.read(magic, 4);
+    if (!file || std::memcmp(magic, NTUPLE_WEIGHTS_MAGIC, 4) != 0 || readUnsigned(file) != NTUPLE_WEIGHTS_VERSION ||
+        readUnsigned(file) != weights.size()) {
+        throw std::runtime_error("Incorrect weights file.");
+    }
+
+    for (auto &weight: weights) {
+        int low = file.get();
+        int high = file.get();
+        weight = static_cast<std::int16_t>(static_cast<std::uint16_t>(low | (high << 8)));
+    }
+    if (!file) {
+        throw std::runtime_error("Truncated weights file.");
+    }
+    widenedWeights.assign(weights.begin(), weights.end());
+}
+
+void NTupleNetwork::save(std::string const &fileName) const {
+    std::ofstream file(fileName, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open " + fileName);
+    }
+
+    file.write(NTUPLE_WEIGHTS_MAGIC, 4);
+    writeUnsigned(file, NTUPLE_WEIGHTS_VERSION);
+    writeUnsigned(file, static_cast<std::uint32_t>(weights.size()));
+    for (auto weight: weights) {
+        auto bits = static_cast<std::uint16_t>(weight);
+        file.put(static_cast<char>(bits & 0xFF));
+        file.put(static_cast<char>(bits >> 8));
+    }
+}
+
+int NTupleNetwork::evaluate(Position const &position) const {
+    Player us = position.getSideToMove();
+    Bitboard own = position.getPieces(us);
+    Bitboard enemy = position.getPieces(opponentOf(us));
+
+    int score = 0;
+    for (auto const &tuple: tuples) {
+        score += weights[tuple.tableOffset + tupleIndex(tuple, own, enemy)];
+    }
+    return toEvaluation(score);
+}
+
+void NTupleNetwork::computeIndices(Position const &position, int *indices) const {
+    Player us = position.getSideToMove();
+    Bitboard own = position.getPieces(us);
+    Bitboard enemy = position.getPieces(opponentOf(us));
+
+    for (std::size_t i = 0; i < tuples.size(); i++) {
+        indices[i] = tuples[i].tableOffset + tupleIndex(tuples[i], own, enemy);
+    }
+}
+
+int NTupleNetwork::toEvaluation(int weightSum) {
+    //108 TRAINED int16 WEIGHTS CAN SUM FAR PAST THE WIN SCORES
+    return std::clamp(weightSum / NTUPLE_WEIGHT_SCALE, -MAX_EVALUATION, MAX_EVALUATION);
+}
+
+int NTupleNetwork::tupleIndex(NTuple const &tuple, Bitboard own, Bitboard enemy) {
+    int index = 0;
+    for (int i = 0; i < NTUPLE_LENGTH; i++) {
+        int cell = tuple.cells[i];
+        if (cell < 0) continue;
+        index += POWERS_OF_THREE[i] * static_cast<int>(((own >> cell) & 1) + 2 * ((enemy >> cell) & 1));
+    }
+    return index;
+}
+
+std::vector<NTuple> const &NTupleNetwork::getTuples() const {
+    return tuples;
+}
+
+int NTupleNetwork::getTupleCount() const {
+    return static_cast<int>(tuples.size());
+}
+
+int NTupleNetwork::getWeightCount() const {
+    return static_cast<int>(weights.size());
+}
+
+std::vector<std::int16_t> const &NTupleNetwork::getWeights() const {
+    return weights;
+}
+
+std::vector<std::int32_t> const &NTupleNetwork::getWidenedWeights() const {
+    return widenedWeights;
+}
+
+void NTupleNetwork::setWeights(std::vector<std::int16_t> const &newWeights) {
+    if (newWeights.size() != weights.size()) {
+        throw std::runtime_error("Incorrect number of weights.");
+    }
+    weights = newWeights;
+    widenedWeights.assign(weights.begin(), weights.end());
+}
+
+NTupleNetwork const *getEvaluationNetwork() {
+    return evaluationNetwork.get();
+}
+
+bool loadEvaluationNetwork(std::string const &fileName) {
+    if (!std::filesystem::exists(fileName)) {
+        return false;
+    }
+
+    auto network = std::make_unique<NTupleNetwork>();
+    network->load(fileName);
+    evaluationNetwork = std::move(network);
+    return true;
+}
@@ -1,7 +1,7 @@
 #include "headers/PauseMenu.hpp"
 #include "headers/Game.hpp"
 
-PauseMenu::PauseMenu(sf::RenderWindow &window, Game &game) : window(window), game(game) {
+PauseMenu::PauseMenu(sf::RenderWindow &window, Game &game) : window(window), game(game), analysisShown(false) {
     if (!font.loadFromFile("../fonts/Silkscreen-Regular.ttf")) {
         throw std::runtime_error("Unable to load the font.");
     }
@@ -9,17 +9,21 @@ PauseMenu::PauseMenu(sf::RenderWindow &window, Game &game) : window(window), gam
     backToGameText.setFont(font);
     backToGameText.setString("Back to game");
     backToGameText.setCharacterSize(25);
-    backToGameText.setPosition((window.getSize().x - backToGameText.getLocalBounds().width) / 2, 230);
+    backToGameText.setPosition((window.getSize().x - backToGameText.getLocalBounds().width) / 2, 205);
+
+    analysisText.setFont(font);
+    analysisText.setCharacterSize(25);
+    updateAnalysisText();
 
     saveAndExitText.setFont(font);
     saveAndExitText.setString("Save and exit");
     saveAndExitText.setCharacterSize(25);
-    saveAndExitText.setPosition((window.getSize().x - saveAndExitText.getLocalBounds().width) / 2, 280);
+    saveAndExitText.setPosition((window.getSize().x - saveAndExitText.getLocalBounds().width) / 2, 305);
 
     exitText.setFont(font);
     exitText.setString("Exit");
     exitText.setCharacterSize(25);
-    exitText.setPosition((window.getSize().x - exitText.getLocalBounds().width) / 2, 330);
+    exitText.setPosition((window.getSize().x - exitText.getLocalBounds().width) / 2, 355);
 
     float squareSizeX = 400.0f;
     float squareSizeY = 300.0f;
@@ -36,10 +40,16 @@ PauseMenu::PauseMenu(sf::RenderWindow &window, Game &game) : window(window), gam
 }
 
 void PauseMenu::draw() {
+    //THE A KEY CAN TOGGLE THE ANALYSIS AS WELL
+    if (game.isAnalysing() != analysisShown) {
+        analysisShown = game.isAnalysing();
+        updateAnalysisText();
+    }
     updateTextColors();
 
     window.draw(background);
     window.draw(backToGameText);
+    window.draw(analysisText);
     window.draw(saveAndExitText);
     window.draw(exitText);
 }
@@ -47,6 +57,9 @@ void PauseMenu::draw() {
 void PauseMenu::onMouseClick(int mouseX, int mouseY) {
     if (backToGameText.getGlobalBounds().contains(mouseX, mouseY)) {
         game.switchToGame();
+    } else if (analysisText.getGlobalBounds().contains(mouseX, mouseY)) {
+        game.toggleAnalysis();
+        game.switchToGame();
     } else if (saveAndExitText.getGlobalBounds().contains(mouseX, mouseY)) {
         game.saveGame();
         game.openMainMenu();
@@ -55,8 +68,14 @@ void PauseMenu::onMouseClick(int mouseX, int mouseY) {
     }
 }
 
+void PauseMenu::updateAnalysisText() {
+    analysisText.setString(analysisShown ? "Stop analysis" : "Start analysis");
+    analysisText.setPosition((window.getSize().x - analysisText.getLocalBounds().width) / 2, 255);
+}
+
 void PauseMenu::updateTextColors() {
     updateTextColor(backToGameText);
+    updateTextColor(analysisText);
     updateTextColor(saveAndExitText);
     updateTextColor(exitText);
 }
@@ -0,0 +1,203 @@
+#include "headers/Perft.hpp"
+#include "headers/Evaluation.hpp"
+#include "headers/Symmetry.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    struct PositionHasher {
+        std::size_t operator()(Position const &position) const { return position.hash(); }
+    };
+
+    struct FrontierEntry {
+        Position position;
+        std::uint64_t multiplicity;
+    };
+
+    struct PerftContext {
+        PerftCache *cache;
+        std::uint64_t cacheProbes = 0;
+        std::uint64_t cacheHits = 0;
+    };
+
+    void record(PerftCounts &counts, Position const &parent, Move move, bool terminal, std::uint64_t multiplier) {
+        counts.nodes += multiplier;
+        if (parent.countCaptures(move) > 0) counts.captures += multiplier;
+        if (move.isJump()) {
+            counts.jumps += multiplier;
+        } else {
+            counts.clones += multiplier;
+        }
+        if (terminal) counts.terminals += multiplier;
+    }
+
+    void countMoves(Position const &position, int depth, PerftCounts *counts, PerftContext &context);
+
+    //counts[0] RECEIVES THE CHILDREN OF position, counts[depth - 1] THE DEEPEST PLY
+    void expand(Position const &position, int depth, PerftCounts *counts, PerftContext &context) {
+        MoveList moves;
+        position.generateMoves(moves);
+        for (Move move: moves) {
+            Position child = position;
+            child.makeMove(move);
+            bool terminal = isTerminal(child);
+            record(counts[0], position, move, terminal, 1);
+            if (depth > 1 && !terminal) {
+                countMoves(child, depth - 1, counts + 1, context);
+            }
+        }
+    }
+
+    void countMoves(Position const &position, int depth, PerftCounts *counts, PerftContext &context) {
+        if (context.cache == nullptr || depth < 2 || depth > PERFT_CACHE_DEPTH) {
+            expand(position, depth, counts, context);
+            return;
+        }
+
+        auto canonical = canonicalize(position).position;
+        std::array<PerftCounts, PERFT_CACHE_DEPTH> subtree{};
+        context.cacheProbes++;
+        if (context.cache->probe(canonical, depth, subtree)) {
+            context.cacheHits++;
+        } else {
+            expand(position, depth, subtree.data(), context);
+            context.cache->store(canonical, depth, subtree);
+        }
+        for (int ply = 0; ply < depth; ply++) {
+            counts[ply].add(subtree[ply]);
+        }
+    }
+}
+
+void PerftCounts::add(PerftCounts const &other, std::uint64_t multiplier) {
+    nodes += other.nodes * multiplier;
+    captures += other.captures * multiplier;
+    clones += other.clones * multiplier;
+    jumps += other.jumps * multiplier;
+    terminals += other.terminals * multiplier;
+}
+
+double PerftResult::getBranchingFactor(int ply) const {
+    if (ply <= 0 || ply > depth) return 0;
+    auto parents = plies[ply - 1].nodes - plies[ply - 1].terminals;
+    return parents == 0 ? 0 : static_cast<double>(plies[ply].nodes) / static_cast<double>(parents);
+}
+
+std::uint64_t PerftResult::getTotalNodes() const {
+    std::uint64_t total = 0;
+    for (int ply = 0; ply <= depth; ply++) {
+        total += plies[ply].nodes;
+    }
+    return total;
+}
+
+double PerftResult::getNodesPerSecond() const {
+    return microseconds == 0 ? 0 : static_cast<double>(getTotalNodes()) * 1e6 / static_cast<double>(microseconds);
+}
+
+PerftCache::PerftCache(std::size_t megabytes) : mask(0), locks(std::make_unique<std::mutex[]>(LOCK_COUNT)) {
+    std::size_t count = megabytes * 1024 * 1024 / sizeof(Entry);
+    count = count < 1024 ? 1024 : std::bit_floor(count);
+
+    entries.assign(count, Entry());
+    mask = count - 1;
+}
+
+bool PerftCache::probe(Position const &canonical, int depth, std::array<PerftCounts, PERFT_CACHE_DEPTH> &counts) {
+    auto index = canonical.hash() & mask;
+    std::lock_guard lock(locks[index % LOCK_COUNT]);
+    auto const &entry = entries[index];
+    if (entry.depth != depth || !(entry.position == canonical)) {
+        return false;
+    }
+    counts = entry.counts;
+    return true;
+}
+
+void PerftCache::store(Position const &canonical, int depth,
+                       std::array<PerftCounts, PERFT_CACHE_DEPTH> const &counts) {
+    auto index = canonical.hash() & mask;
+    std::lock_guard lock(locks[index % LOCK_COUNT]);
+    auto &entry = entries[index];
+    //DEEPER SUBTREES COST MORE TO RECOUNT, SO THEY ARE NOT REPLACED BY SHALLOWER ONES
+    if (entry.depth > depth) {
+        return;
+    }
+    entry.position = canonical;
+    entry.depth = depth;
+    entry.counts = counts;
+}
+
+PerftResult perft(Position const &position, int depth, TaskScheduler &scheduler, PerftCache *cache) {
+    if (depth < 0 || depth > MAX_PERFT_DEPTH) {
+        throw std::runtime_error("Perft depth must be between 0 and " + std::to_string(MAX_PERFT_DEPTH) + ".");
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    PerftResult result;
+    result.depth = depth;
+    result.plies[0].nodes = 1;
+    result.plies[0].terminals = isTerminal(position) ? 1 : 0;
+
+    std::vector<FrontierEntry> frontier;
+    if (!isTerminal(position)) {
+        frontier.push_back({position, 1});
+    }
+
+    //SEVERAL TASKS PER WORKER, SO A FEW LARGE SUBTREES DO NOT LEAVE THE OTHER WORKERS IDLE AT THE END
+    std::size_t wantedTasks = static_cast<std::size_t>(scheduler.getThreadCount()) * 64;
+    while (result.splitPly < depth - 1 && !frontier.empty() && frontier.size() < wantedTasks) {
+        std::vector<FrontierEntry> next;
+        std::unordered_map<Position, std::size_t, PositionHasher> indices;
+        auto &counts = result.plies[result.splitPly + 1];
+
+        for (auto const &entry: frontier) {
+            MoveList moves;
+            entry.position.generateMoves(moves);
+            for (Move move: moves) {
+                Position child = entry.position;
+                child.makeMove(move);
+                bool terminal = isTerminal(child);
+                record(counts, entry.position, move, terminal, entry.multiplicity);
+                if (terminal) continue;
+
+                auto [found, inserted] = indices.try_emplace(child, next.size());
+                if (inserted) {
+                    next.push_back({child, entry.multiplicity});
+                } else {
+                    next[found->second].multiplicity += entry.multiplicity;
+                }
+            }
+        }
+        frontier.swap(next);
+        result.splitPly++;
+    }
+
+    int remaining = depth - result.splitPly;
+    if (remaining > 0) {
+        std::mutex resultMutex;
+        for (auto const &entry: frontier) {
+            scheduler.submit([&result, &resultMutex, &entry, remaining, cache] {
+                std::array<PerftCounts, MAX_PERFT_DEPTH> counts{};
+                PerftContext context{cache};
+                countMoves(entry.position, remaining, counts.data(), context);
+
+                std::lock_guard lock(resultMutex);
+                for (int ply = 0; ply < remaining; ply++) {
+                    result.plies[result.splitPly + 1 + ply].add(counts[ply], entry.multiplicity);
+                }
+                result.cacheProbes += context.cacheProbes;
+                result.cacheHits += context.cacheHits;
+            });
+        }
+        result.taskCount = frontier.size();
+        scheduler.wait();
+    }
+
+    result.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+    return result;
+}
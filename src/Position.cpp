@@ -0,0 +1,271 @@
+#include "headers/Position.hpp"
+#include <bit>
+#include <stdexcept>
+
+namespace {
+    //https://prng.di.unimi.it/splitmix64.c
+    constexpr std::uint64_t splitMix64(std::uint64_t &state) {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    struct ZobristKeys {
+        std::array<std::array<std::uint64_t, CELL_COUNT>, 2> pieces{};
+        std::uint64_t sideToMove = 0;
+    };
+
+    constexpr ZobristKeys makeZobristKeys() {
+        ZobristKeys keys;
+        std::uint64_t state = 0x4865787861676F6EULL;
+        for (auto &player: keys.pieces) {
+            for (auto &key: player) {
+                key = splitMix64(state);
+            }
+        }
+        keys.sideToMove = splitMix64(state);
+        return keys;
+    }
+
+    constexpr ZobristKeys ZOBRIST = makeZobristKeys();
+
+    int cellFromName(std::string const &text, std::size_t offset) {
+        if (offset + 2 > text.size()) return -1;
+        int column = text[offset] - 'a';
+        int row = text[offset + 1] - '1';
+        if (column < 0 || column >= BOARD_COLUMNS || row < 0 || row >= CELLS.columnSize[column]) return -1;
+        return CELLS.columnStart[column] + row;
+    }
+}
+
+std::string Move::toString() const {
+    if (isNull()) return "none";
+    if (!isJump()) return cellName(to);
+    return cellName(from) + cellName(to);
+}
+
+Position::Position() : pieces{0, 0}, key(0), plyCount(0), sideToMove(Player::PLAYER_A) {
+    //START POSITION OF THE ORIGINAL GAME, Board::start COPIES IT
+    int last = BOARD_COLUMNS - 1;
+    int middle = BOARD_COLUMNS / 2;
+    setOwner(CELLS.columnStart[0], Player::PLAYER_A);
+    setOwner(CELLS.columnStart[last], Player::PLAYER_A);
+    setOwner(CELLS.columnStart[middle] + CELLS.columnSize[middle] - 1, Player::PLAYER_A);
+    setOwner(CELLS.columnStart[0] + CELLS.columnSize[0] - 1, Player::PLAYER_B);
+    setOwner(CELLS.columnStart[last] + CELLS.columnSize[last] - 1, Player::PLAYER_B);
+    setOwner(CELLS.columnStart[middle], Player::PLAYER_B);
+}
+
+Position Position::fromString(std::string const &line) {
+    if (line.size() != SAVE_STRING_LENGTH) {
+        throw std::runtime_error("Incorrect file content.");
+    }
+
+    Position position;
+    position.pieces = {0, 0};
+    position.key = 0;
+
+    if (line[0] == '1') {
+        position.setSideToMove(Player::PLAYER_A);
+    } else if (line[0] == '2') {
+        position.setSideToMove(Player::PLAYER_B);
+    } else {
+        throw std::runtime_error("Incorrect file content.");
+    }
+
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        char digit = line[cell + 1];
+        if (digit < '0' || digit > '2') {
+            throw std::runtime_error("Incorrect file content.");
+        }
+        position.setOwner(cell, static_cast<Player>(digit - '0'));
+    }
+    return position;
+}
+
+Position Position::fromBitboards(Bitboard playerA, Bitboard playerB, Player sideToMove) {
+    if ((playerA & playerB) || ((playerA | playerB) & ~ALL_CELLS) || sideToMove == Player::NO_PLAYER) {
+        throw std::runtime_error("Incorrect position.");
+    }
+
+    Position position;
+    position.pieces = {playerA, playerB};
+    position.sideToMove = sideToMove;
+    position.key = position.computeHash();
+    return position;
+}
+
+std::string Position::toString() const {
+    std::string line(SAVE_STRING_LENGTH, '0');
+    line[0] = static_cast<char>('0' + static_cast<int>(sideToMove));
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        line[cell + 1] = static_cast<char>('0' + static_cast<int>(getOwner(cell)));
+    }
+    return line;
+}
+
+Player Position::getSideToMove() const {
+    return sideToMove;
+}
+
+Player Position::getOwner(int cell) const {
+    if (pieces[0] & cellBit(cell)) return Player::PLAYER_A;
+    if (pieces[1] & cellBit(cell)) return Player::PLAYER_B;
+    return Player::NO_PLAYER;
+}
+
+void Position::setOwner(int cell, Player owner) {
+    for (int player = 0; player < 2; player++) {
+        if (pieces[player] & cellBit(cell)) key ^= ZOBRIST.pieces[player][cell];
+        pieces[player] &= ~cellBit(cell);
+    }
+    if (owner != Player::NO_PLAYER) {
+        pieces[playerIndex(owner)] |= cellBit(cell);
+        key ^= ZOBRIST.pieces[playerIndex(owner)][cell];
+    }
+}
+
+void Position::setSideToMove(Player player) {
+    if ((player == Player::PLAYER_B) != (sideToMove == Player::PLAYER_B)) key ^= ZOBRIST.sideToMove;
+    sideToMove = player;
+}
+
+Bitboard Position::getPieces(Player player) const {
+    return pieces[playerIndex(player)];
+}
+
+Bitboard Position::getEmpty() const {
+    return ALL_CELLS & ~(pieces[0] | pieces[1]);
+}
+
+int Position::getPoints(Player player) const {
+    return std::popcount(getPieces(player));
+}
+
+void Position::generateMoves(MoveList &moveList) const {
+    moveList.size = 0;
+    Bitboard own = pieces[playerIndex(sideToMove)];
+    Bitboard empty = getEmpty();
+
+    //ONE CLONE PER TARGET CELL, NO MATTER WHICH ADJACENT PIECE IS CLONED
+    for (Bitboard targets = empty; targets; targets &= targets - 1) {
+        int to = std::countr_zero(targets);
+        Bitboard sources = CELLS.neighbours[to] & own;
+        if (sources) {
+            moveList.moves[moveList.size++] = {static_cast<std::int8_t>(std::countr_zero(sources)),
+                                               static_cast<std::int8_t>(to)};
+        }
+    }
+    for (Bitboard sources = own; sources; sources &= sources - 1) {
+        int from = std::countr_zero(sources);
+        for (Bitboard targets = CELLS.jumps[from] & empty; targets; targets &= targets - 1) {
+            moveList.moves[moveList.size++] = {static_cast<std::int8_t>(from),
+                                               static_cast<std::int8_t>(std::countr_zero(targets))};
+        }
+    }
+}
+
+bool Position::hasMoves() const {
+    Bitboard own = pieces[playerIndex(sideToMove)];
+    Bitboard empty = getEmpty();
+    for (Bitboard sources = own; sources; sources &= sources - 1) {
+        int from = std::countr_zero(sources);
+        if ((CELLS.neighbours[from] | CELLS.jumps[from]) & empty) return true;
+    }
+    return false;
+}
+
+int Position::countCaptures(Move move) const {
+    return std::popcount(CELLS.neighbours[move.to] & pieces[1 - playerIndex(sideToMove)]);
+}
+
+bool Position::isLegal(Move move) const {
+    if (move.from < 0 || move.from >= CELL_COUNT || move.to < 0 || move.to >= CELL_COUNT) return false;
+    if (!(pieces[playerIndex(sideToMove)] & cellBit(move.from))) return false;
+    if (!(getEmpty() & cellBit(move.to))) return false;
+    return ((CELLS.neighbours[move.from] | CELLS.jumps[move.from]) & cellBit(move.to)) != 0;
+}
+
+Move Position::parseMove(std::string const &text) const {
+    Move move;
+    if (text.size() == 2) {
+        move.to = static_cast<std::int8_t>(cellFromName(text, 0));
+        Bitboard sources = move.to >= 0 ? CELLS.neighbours[move.to] & pieces[playerIndex(sideToMove)] : 0;
+        if (sources) move.from = static_cast<std::int8_t>(std::countr_zero(sources));
+    } else if (text.size() == 4) {
+        move.from = static_cast<std::int8_t>(cellFromName(text, 0));
+        move.to = static_cast<std::int8_t>(cellFromName(text, 2));
+    }
+
+    if (!isLegal(move)) {
+        throw std::runtime_error("Illegal move: " + text);
+    }
+    return move;
+}
+
+void Position::makeMove(Move move) {
+    int us = playerIndex(sideToMove);
+    Bitboard captured = CELLS.neighbours[move.to] & pieces[1 - us];
+
+    if (move.isJump()) {
+        pieces[us] &= ~cellBit(move.from);
+        key ^= ZOBRIST.pieces[us][move.from];
+    }
+    pieces[us] |= cellBit(move.to) | captured;
+    pieces[1 - us] &= ~captured;
+    key ^= ZOBRIST.pieces[us][move.to] ^ ZOBRIST.sideToMove;
+    for (; captured; captured &= captured - 1) {
+        int cell = std::countr_zero(captured);
+        key ^= ZOBRIST.pieces[0][cell] ^ ZOBRIST.pieces[1][cell];
+    }
+    sideToMove = opponentOf(sideToMove);
+    plyCount++;
+}
+
+bool Position::isGameOver() const {
+    //SAME VERDICT AS Board::checkForWinner
+    return getEmpty() == 0 || pieces[0] == 0 || pieces[1] == 0;
+}
+
+int Position::getPlyCount() const {
+    return plyCount;
+}
+
+std::uint64_t Position::hash() const {
+    return key;
+}
+
+bool Position::operator==(Position const &other) const {
+    return pieces == other.pieces && sideToMove == other.sideToMove;
+}
+
+std::uint64_t Position::hashBitboards(Bitboard playerA, Bitboard playerB, Player sideToMove) {
+    std::uint64_t result = sideToMove == Player::PLAYER_B ? ZOBRIST.sideToMove : 0;
+    for (Bitboard cells = playerA; cells; cells &= cells - 1) {
+        result ^= ZOBRIST.pieces[0][std::countr_zero(cells)];
+    }
+    for (Bitboard cells = playerB; cells; cells &= cells - 1) {
+        result ^= ZOBRIST.pieces[1][std::countr_zero(cells)];
+    }
+    return result;
+}
+
+std::uint64_t Position::computeHash() const {
+    return hashBitboards(pieces[0], pieces[1], sideToMove);
+}
+
+int Position::playerIndex(Player player) {
+    return player == Player::PLAYER_B ? 1 : 0;
+}
+
+Player opponentOf(Player player) {
+    return player == Player::PLAYER_A ? Player::PLAYER_B : Player::PLAYER_A;
+}
+
+std::string cellName(int cell) {
+    std::string name;
+    name += static_cast<char>('a' + CELLS.column[cell]);
+    name += static_cast<char>('1' + CELLS.row[cell]);
+    return name;
+}
@@ -0,0 +1,97 @@
+#include "headers/PositionReader.hpp"
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+    constexpr int MAGIC_SIZE = 4;
+    constexpr Bitboard SIDE_TO_MOVE_BIT = Bitboard(1) << 63;
+
+    Bitboard readLittleEndian(unsigned char const *bytes) {
+        Bitboard value = 0;
+        for (int i = 7; i >= 0; i--) {
+            value = (value << 8) | bytes[i];
+        }
+        return value;
+    }
+
+    void writeLittleEndian(Bitboard value, unsigned char *bytes) {
+        for (int i = 0; i < 8; i++) {
+            bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+        }
+    }
+}
+
+PositionReader::PositionReader(std::istream &input, PositionFormat format) : input(input), format(format) {
+    if (format != PositionFormat::TEXT) {
+        detectFormat();
+    }
+}
+
+bool PositionReader::next(Position &position) {
+    return format == PositionFormat::BINARY ? nextBinary(position) : nextText(position);
+}
+
+void PositionReader::detectFormat() {
+    if (input.peek() != BINARY_POSITIONS_MAGIC[0]) {
+        if (format == PositionFormat::BINARY) {
+            throw std::runtime_error("Missing binary positions header.");
+        }
+        format = PositionFormat::TEXT;
+        return;
+    }
+
+    std::array<char, MAGIC_SIZE> magic{};
+    if (!input.read(magic.data(), MAGIC_SIZE) || std::memcmp(magic.data(), BINARY_POSITIONS_MAGIC, MAGIC_SIZE) != 0) {
+        throw std::runtime_error("Missing binary positions header.");
+    }
+    format = PositionFormat::BINARY;
+}
+
+bool PositionReader::nextText(Position &position) {
+    while (std::getline(input, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        position = Position::fromString(line);
+        return true;
+    }
+    return false;
+}
+
+bool PositionReader::nextBinary(Position &position) {
+    std::array<unsigned char, BINARY_POSITION_SIZE> record{};
+    input.read(reinterpret_cast<char *>(record.data()), BINARY_POSITION_SIZE);
+
+    if (input.gcount() == 0) {
+        return false;
+    }
+    if (input.gcount() != BINARY_POSITION_SIZE) {
+        throw std::runtime_error("Truncated binary position.");
+    }
+
+    Bitboard playerA = readLittleEndian(record.data());
+    Bitboard playerB = readLittleEndian(record.data() + 8);
+    Player sideToMove = (playerA & SIDE_TO_MOVE_BIT) ? Player::PLAYER_B : Player::PLAYER_A;
+    position = Position::fromBitboards(playerA & ~SIDE_TO_MOVE_BIT, playerB, sideToMove);
+    return true;
+}
+
+PositionWriter::PositionWriter(std::ostream &output) : output(output) {
+    output.write(BINARY_POSITIONS_MAGIC, MAGIC_SIZE);
+}
+
+void PositionWriter::write(Position const &position) {
+    Bitboard playerA = position.getPieces(Player::PLAYER_A);
+    if (position.getSideToMove() == Player::PLAYER_B) {
+        playerA |= SIDE_TO_MOVE_BIT;
+    }
+
+    std::array<unsigned char, BINARY_POSITION_SIZE> record{};
+    writeLittleEndian(playerA, record.data());
+    writeLittleEndian(position.getPieces(Player::PLAYER_B), record.data() + 8);
+    output.write(reinterpret_cast<char const *>(record.data()), BINARY_POSITION_SIZE);
+}
@@ -23,32 +23,47 @@ void SavedGamesMenu::draw() {
 }
 
 void SavedGamesMenu::refresh() {
+    //A SCAN STILL RUNNING FROM AN EARLIER VISIT IS NO LONGER NEEDED
+    scanToken.cancel();
+    scanToken = CancellationToken();
     savedGames.clear();
 
-    auto folderPath = "../saved";
+    game.getScheduler().submitWithContinuation([&board = game.getBoard()] {
+        //A SAVE STILL QUEUED BEHIND OTHER TASKS IS WRITTEN FIRST, SO THE GAME JUST SAVED IS LISTED
+        board.flushSaves();
+        auto folderPath = SAVE_DIRECTORY;
 
-    if (!std::filesystem::exists(folderPath)) {
-        std::filesystem::create_directory(folderPath);
-    }
+        if (!std::filesystem::exists(folderPath)) {
+            std::filesystem::create_directory(folderPath);
+        }
 
-    int positionY = 70;
-    std::vector<std::filesystem::directory_entry> entries;
-    for (auto &file: std::filesystem::directory_iterator(folderPath)) {
-        entries.emplace_back(file);
-    }
+        std::vector<std::filesystem::directory_entry> entries;
+        for (auto &file: std::filesystem::directory_iterator(folderPath)) {
+            entries.emplace_back(file);
+        }
 
-    std::reverse(entries.begin(), entries.end());
+        std::reverse(entries.begin(), entries.end());
 
-    auto i = int();
-    for (auto &entry: entries) {
+        std::vector<std::string> fileNames;
+        for (auto &entry: entries) {
+            fileNames.push_back(entry.path().filename().string());
+            if (fileNames.size() == 8) break;
+        }
+        return fileNames;
+    }, [this](std::vector<std::string> const &fileNames) {
+        showSavedGames(fileNames);
+    }, TaskPriority::UI_CRITICAL, scanToken);
+}
+
+void SavedGamesMenu::showSavedGames(std::vector<std::string> const &fileNames) {
+    int positionY = 70;
+    for (auto &fileName: fileNames) {
         sf::Text savedGame;
         savedGame.setFont(font);
-        savedGame.setString(entries[i].path().filename().string());
+        savedGame.setString(fileName);
         savedGame.setCharacterSize(30);
         savedGame.setPosition((window.getSize().x - savedGame.getLocalBounds().width) / 2, positionY += 50);
         savedGames.emplace_back(savedGame);
-        i++;
-        if (i == 8) break;
     }
 }
 
@@ -0,0 +1,287 @@
+#include "headers/Search.hpp"
+#include "headers/Symmetry.hpp"
+#include "headers/TimeManager.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+    constexpr int INFINITE_SCORE = WIN_SCORE + 1;
+
+    //WIN SCORES ARE STORED RELATIVE TO THE NODE, NOT TO THE ROOT
+    int scoreToTable(int score, int ply) {
+        if (score > WIN_SCORE - MAX_PLY) return score + ply;
+        if (score < -WIN_SCORE + MAX_PLY) return score - ply;
+        return score;
+    }
+
+    int scoreFromTable(int score, int ply) {
+        if (score > WIN_SCORE - MAX_PLY) return score - ply;
+        if (score < -WIN_SCORE + MAX_PLY) return score + ply;
+        return score;
+    }
+}
+
+Search::Search(std::size_t hashMegabytes) : table(hashMegabytes), stopped(false), pondering(false), rootDepth(0),
+                                            rootBestMoveNodes(0), excludedRootMoves(), excludedRootMoveCount(0),
+                                            pvTable(), pvLength(), killers() {}
+
+SearchResult Search::run(Position const &position, SearchLimits const &searchLimits) {
+    limits = searchLimits;
+    if (limits.timeManager) {
+        auto maximum = limits.timeManager->getMaximumMilliseconds();
+        limits.milliseconds = limits.milliseconds > 0 ? std::min(limits.milliseconds, maximum) : maximum;
+    }
+    startTime = std::chrono::steady_clock::now();
+    stopped = false;
+    pondering = limits.ponderSignal && limits.ponderSignal->load();
+    killers = {};
+    statistics.reset();
+    statistics.searches = 1;
+
+    SearchResult result;
+    if (isTerminal(position)) {
+        result.score = terminalScore(position, 0);
+        return result;
+    }
+
+    auto iterationStart = startTime;
+    std::uint64_t iterationNodes = 0;
+    int lineLimit = std::clamp(limits.multiPv, 1, MAX_MULTI_PV);
+    std::array<SearchLine, MAX_MULTI_PV> lines;
+
+    for (int depth = 1; depth <= limits.depth && depth < MAX_PLY; depth++) {
+        rootDepth = depth;
+        int score = 0;
+        std::uint64_t bestMoveNodes = 0;
+        int lineCount = 0;
+        excludedRootMoveCount = 0;
+        while (lineCount < lineLimit) {
+            rootBestMoveNodes = 0;
+            int lineScore = alphaBeta(position, depth, -INFINITE_SCORE, INFINITE_SCORE, 0);
+            //NO ROOT MOVE LEFT ONCE ALL LEGAL MOVES ARE EXCLUDED
+            if ((stopped && depth > 1) || pvLength[0] == 0) break;
+            if (lineCount == 0) {
+                score = lineScore;
+                bestMoveNodes = rootBestMoveNodes;
+            }
+            auto &line = lines[lineCount++];
+            line.score = lineScore;
+            std::copy_n(pvTable[0].begin(), pvLength[0], line.principalVariation.moves.begin());
+            line.principalVariation.length = pvLength[0];
+            excludedRootMoves[excludedRootMoveCount++] = pvTable[0][0];
+        }
+        excludedRootMoveCount = 0;
+        auto now = std::chrono::steady_clock::now();
+        auto &iteration = statistics.iterations[statistics.iterationCount++];
+        iteration.depth = depth;
+        iteration.nodes = statistics.nodes - iterationNodes;
+        iteration.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(now - iterationStart).count();
+        iterationStart = now;
+        iterationNodes = statistics.nodes;
+
+        if (stopped && depth > 1) break;
+
+        statistics.depth = depth;
+        result.bestMove = lines[0].principalVariation.moves[0];
+        result.score = score;
+        result.depth = depth;
+        result.principalVariation = lines[0].principalVariation;
+        result.nodes = statistics.nodes;
+        result.bestMoveNodes = bestMoveNodes;
+        std::copy_n(lines.begin(), lineCount, result.lines.begin());
+        result.lineCount = lineCount;
+
+        if (iterationCallback) {
+            statistics.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(now - startTime).count();
+            iterationCallback(result, statistics);
+        }
+        if (stopped || isWinScore(score)) break;
+        if (limits.timeManager && !pondering) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - startTime).count();
+            if (limits.timeManager->shouldStop(result, elapsed)) break;
+        }
+    }
+
+    statistics.microseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - startTime).count();
+    result.nodes = statistics.nodes;
+    return result;
+}
+
+void Search::stop() {
+    stopped = true;
+}
+
+SearchStatistics const &Search::getStatistics() const {
+    return statistics;
+}
+
+void Search::clearHash() {
+    table.invalidate();
+}
+
+void Search::setHashSize(std::size_t megabytes) {
+    table.resize(megabytes);
+}
+
+void Search::setIterationCallback(IterationCallback callback) {
+    iterationCallback = std::move(callback);
+}
+
+int Search::alphaBeta(Position const &position, int depth, int alpha, int beta, int ply) {
+    pvLength[ply] = ply;
+    statistics.nodes++;
+    statistics.selectiveDepth = std::max(statistics.selectiveDepth, ply);
+    //THE FIRST ITERATION IS NEVER INTERRUPTED SO THAT THERE IS ALWAYS A MOVE TO RETURN
+    if (ply > 0 && rootDepth > 1) {
+        checkLimits();
+        if (stopped) return 0;
+    }
+
+    if (isTerminal(position)) {
+        return terminalScore(position, ply);
+    }
+    if (depth == 0 || ply >= MAX_PLY - 1) {
+        return evaluate(position);
+    }
+
+    //ALL 12 SYMMETRIC COPIES OF A POSITION SHARE ONE ENTRY, MOVES ARE STORED IN THE CANONICAL ORIENTATION
+    auto canonical = canonicalKey(position);
+    auto key = canonical.key;
+    Move hashMove;
+    TranspositionEntry entry;
+    statistics.tableProbes++;
+    if (table.probe(key, entry)) {
+        statistics.tableHits++;
+        hashMove = transformMove(entry.move, INVERSE_SYMMETRIES[canonical.symmetry]);
+        int score = scoreFromTable(entry.score, ply);
+        //NO CUTOFFS IN PV NODES, OTHERWISE THE PRINCIPAL VARIATION WOULD END AT THE TABLE HIT
+        bool pvNode = beta - alpha > 1;
+        if (ply > 0 && !pvNode && entry.depth >= depth &&
+            (entry.bound == BoundType::EXACT ||
+             (entry.bound == BoundType::LOWER_BOUND && score >= beta) ||
+             (entry.bound == BoundType::UPPER_BOUND && score <= alpha))) {
+            statistics.tableCutoffs++;
+            return score;
+        }
+    }
+
+    MoveList moves;
+    position.generateMoves(moves);
+    std::array<int, MAX_MOVES> scores;
+    scoreMoves(position, moves, hashMove, ply, scores);
+
+    int originalAlpha = alpha;
+    int bestScore = -INFINITE_SCORE;
+    Move bestMove;
+    int searchedMoves = 0;
+
+    for (int i = 0; i < moves.size; i++) {
+        //SELECTION SORT STEP: MOST NODES CUT OFF AFTER ONE OR TWO MOVES
+        int best = i;
+        for (int j = i + 1; j < moves.size; j++) {
+            if (scores[j] > scores[best]) best = j;
+        }
+        std::swap(moves.moves[i], moves.moves[best]);
+        std::swap(scores[i], scores[best]);
+
+        Move move = moves.moves[i];
+        if (ply == 0 && isExcludedRootMove(move)) continue;
+        Position child = position;
+        child.makeMove(move);
+        auto nodesBefore = statistics.nodes;
+
+        int score;
+        if (searchedMoves++ == 0) {
+            score = -alphaBeta(child, depth - 1, -beta, -alpha, ply + 1);
+        } else {
+            score = -alphaBeta(child, depth - 1, -alpha - 1, -alpha, ply + 1);
+            if (score > alpha && score < beta) {
+                score = -alphaBeta(child, depth - 1, -beta, -alpha, ply + 1);
+            }
+        }
+        if (stopped && rootDepth > 1) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+            bestMove = move;
+            if (ply == 0) rootBestMoveNodes = statistics.nodes - nodesBefore;
+            if (score > alpha) {
+                alpha = score;
+                updatePrincipalVariation(move, ply);
+                if (alpha >= beta) {
+                    statistics.betaCutoffs++;
+                    if (searchedMoves == 1) statistics.firstMoveCutoffs++;
+                    if (killers[ply][0] != move) {
+                        killers[ply][1] = killers[ply][0];
+                        killers[ply][0] = move;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    //WITH ROOT MOVES EXCLUDED THE SCORE IS NOT THE POSITION'S
+    if (ply == 0 && excludedRootMoveCount > 0) return bestScore;
+
+    BoundType bound = bestScore >= beta ? BoundType::LOWER_BOUND
+                                        : bestScore > originalAlpha ? BoundType::EXACT : BoundType::UPPER_BOUND;
+    table.store(key, transformMove(bestMove, canonical.symmetry), scoreToTable(bestScore, ply), depth, bound);
+    return bestScore;
+}
+
+void Search::scoreMoves(Position const &position, MoveList const &moves, Move hashMove, int ply,
+                        std::array<int, MAX_MOVES> &scores) const {
+    for (int i = 0; i < moves.size; i++) {
+        Move move = moves.moves[i];
+        if (move.isSameAs(hashMove)) {
+            scores[i] = 1 << 20;
+            continue;
+        }
+
+        //MATERIAL GAIN: EVERY CAPTURE FLIPS A PIECE, A CLONE ALSO ADDS ONE
+        int gain = position.countCaptures(move) + (move.isJump() ? 0 : 1);
+        scores[i] = gain * 100;
+        if (move == killers[ply][0] || move == killers[ply][1]) {
+            scores[i] += 50;
+        }
+    }
+}
+
+void Search::updatePrincipalVariation(Move move, int ply) {
+    pvTable[ply][ply] = move;
+    for (int i = ply + 1; i < pvLength[ply + 1]; i++) {
+        pvTable[ply][i] = pvTable[ply + 1][i];
+    }
+    pvLength[ply] = pvLength[ply + 1];
+}
+
+bool Search::isExcludedRootMove(Move move) const {
+    for (int i = 0; i < excludedRootMoveCount; i++) {
+        if (move.isSameAs(excludedRootMoves[i])) return true;
+    }
+    return false;
+}
+
+void Search::checkLimits() {
+    if (limits.stopSignal && limits.stopSignal->load(std::memory_order_relaxed)) {
+        stopped = true;
+        return;
+    }
+    if (pondering) {
+        if (limits.ponderSignal->load(std::memory_order_relaxed)) return;
+        pondering = false;
+        startTime = std::chrono::steady_clock::now();
+    }
+
+    if (limits.nodes > 0 && statistics.nodes >= limits.nodes) {
+        stopped = true;
+    }
+    if (limits.milliseconds > 0 && (statistics.nodes & (TIME_CHECK_INTERVAL - 1)) == 0) {
+        auto elapsed = std::chrono::steady_clock::now() - startTime;
+        if (elapsed >= std::chrono::milliseconds(limits.milliseconds)) {
+            stopped = true;
+        }
+    }
+}
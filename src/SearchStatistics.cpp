@@ -0,0 +1,113 @@
+#include "headers/SearchStatistics.hpp"
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+    double ratio(std::uint64_t part, std::uint64_t whole) {
+        return whole == 0 ? 0.0 : static_cast<double>(part) / static_cast<double>(whole);
+    }
+}
+
+void SearchStatistics::reset() {
+    *this = SearchStatistics();
+}
+
+void SearchStatistics::merge(SearchStatistics const &other) {
+    searches += other.searches;
+    nodes += other.nodes;
+    tableProbes += other.tableProbes;
+    tableHits += other.tableHits;
+    tableCutoffs += other.tableCutoffs;
+    betaCutoffs += other.betaCutoffs;
+    firstMoveCutoffs += other.firstMoveCutoffs;
+    depth = std::max(depth, other.depth);
+    selectiveDepth = std::max(selectiveDepth, other.selectiveDepth);
+    microseconds += other.microseconds;
+
+    //ITERATIONS OF THE SAME DEPTH ARE ADDED UP
+    for (int i = 0; i < other.iterationCount; i++) {
+        auto &iteration = iterations[i];
+        iteration.depth = other.iterations[i].depth;
+        iteration.nodes += other.iterations[i].nodes;
+        iteration.microseconds += other.iterations[i].microseconds;
+    }
+    iterationCount = std::max(iterationCount, other.iterationCount);
+}
+
+double SearchStatistics::getNodesPerSecond() const {
+    return microseconds == 0 ? 0.0 : static_cast<double>(nodes) * 1e6 / static_cast<double>(microseconds);
+}
+
+double SearchStatistics::getEffectiveBranchingFactor() const {
+    if (iterationCount >= 2 && iterations[iterationCount - 2].nodes > 0) {
+        return ratio(iterations[iterationCount - 1].nodes, iterations[iterationCount - 2].nodes);
+    }
+    return depth > 0 ? std::pow(static_cast<double>(nodes), 1.0 / depth) : 0.0;
+}
+
+double SearchStatistics::getTableHitRate() const {
+    return ratio(tableHits, tableProbes);
+}
+
+double SearchStatistics::getTableCutoffRate() const {
+    return ratio(tableCutoffs, tableProbes);
+}
+
+double SearchStatistics::getFirstMoveCutoffRate() const {
+    return ratio(firstMoveCutoffs, betaCutoffs);
+}
+
+std::string SearchStatistics::toJson() const {
+    std::string json = fmt::format(
+            R"({{"searches":{},"nodes":{},"nps":{:.0f},"depth":{},"seldepth":{},"ebf":{:.3f},"tt_probes":{},)"
+            R"("tt_hit_rate":{:.4f},"tt_cutoff_rate":{:.4f},"cutoffs":{},"first_move_cutoff_rate":{:.4f},)"
+            R"("us":{},"iterations":[)",
+            searches, nodes, getNodesPerSecond(), depth, selectiveDepth, getEffectiveBranchingFactor(), tableProbes,
+            getTableHitRate(), getTableCutoffRate(), betaCutoffs, getFirstMoveCutoffRate(), microseconds);
+
+    for (int i = 0; i < iterationCount; i++) {
+        if (i > 0) json += ',';
+        json += fmt::format(R"({{"depth":{},"nodes":{},"us":{}}})", iterations[i].depth, iterations[i].nodes,
+                            iterations[i].microseconds);
+    }
+    json += "]}";
+    return json;
+}
+
+StatisticsSink::StatisticsSink() : output(nullptr) {}
+
+void StatisticsSink::open(std::string const &fileName) {
+    if (fileName == "-") {
+        output = &std::cerr;
+        return;
+    }
+
+    file.open(fileName, std::ios::out | std::ios::app);
+    if (!file.is_open()) {
+        throw std::runtime_error("Unable to open " + fileName);
+    }
+    output = &file;
+}
+
+bool StatisticsSink::isOpen() const {
+    return output != nullptr;
+}
+
+void StatisticsSink::write(SearchStatistics const &statistics) {
+    if (!output) return;
+
+    auto line = statistics.toJson();
+    std::lock_guard lock(mutex);
+    *output << line << '\n';
+}
+
+void StatisticsSink::write(std::string const &label, SearchStatistics const &statistics) {
+    if (!output) return;
+
+    auto line = R"({"label":")" + label + R"(",)" + statistics.toJson().substr(1);
+    std::lock_guard lock(mutex);
+    *output << line << '\n';
+}
@@ -0,0 +1,172 @@
+#include "headers/SpectatorView.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace {
+    const sf::Color BACKGROUND_COLOR(30, 30, 30);
+    const sf::Color FIELD_COLOR = sf::Color::White;
+    const sf::Color PLAYER_A_COLOR = sf::Color::Red;
+    const sf::Color PLAYER_B_COLOR = sf::Color::Blue;
+    constexpr float FIELD_RADIUS = 0.9f;
+    constexpr float PIECE_RADIUS = 0.55f;
+
+    //HEXAGON CORNERS FOR A UNIT SIZE, SAME ORIENTATION AS Hexagon, SPLIT INTO 4 TRIANGLES
+    constexpr std::array<int, 12> HEXAGON_TRIANGLES = {0, 1, 2, 0, 2, 3, 0, 3, 4, 0, 4, 5};
+
+    std::array<sf::Vector2f, 6> hexagonCorners() {
+        std::array<sf::Vector2f, 6> corners;
+        for (int i = 0; i < 6; i++) {
+            corners[i] = {static_cast<float>(std::cos(i * M_PI / 3)), static_cast<float>(std::sin(i * M_PI / 3))};
+        }
+        return corners;
+    }
+
+    const std::array<sf::Vector2f, 6> HEXAGON_CORNERS = hexagonCorners();
+
+    //AN EMPTY CELL SHOWS ITS PIECE IN THE FIELD COLOUR
+    sf::Color pieceColor(Player player) {
+        if (player == Player::PLAYER_A) return PLAYER_A_COLOR;
+        if (player == Player::PLAYER_B) return PLAYER_B_COLOR;
+        return FIELD_COLOR;
+    }
+
+    sf::Color mix(sf::Color from, sf::Color to, float blend) {
+        auto channel = [blend](sf::Uint8 a, sf::Uint8 b) { return static_cast<sf::Uint8>(a + (b - a) * blend); };
+        return {channel(from.r, to.r), channel(from.g, to.g), channel(from.b, to.b), channel(from.a, to.a)};
+    }
+
+    Position emptyBoard() {
+        return Position::fromBitboards(0, 0, Player::PLAYER_A);
+    }
+}
+
+SpectatorView::SpectatorView(sf::RenderWindow &window, int boardCount)
+        : window(window), boardCount(boardCount), buffer(sf::Triangles, sf::VertexBuffer::Stream),
+          useBuffer(sf::VertexBuffer::isAvailable()), shownPositions(boardCount, emptyBoard()),
+          animators(boardCount), animatedCells(boardCount, 0), dirtyCells(boardCount, 0), pieceRadius(0) {
+    buildGeometry();
+}
+
+void SpectatorView::update(std::vector<Position> const &positions) {
+    int count = std::min(boardCount, static_cast<int>(positions.size()));
+    for (int board = 0; board < count; board++) {
+        auto const &position = positions[board];
+        auto &shown = shownPositions[board];
+        if (position == shown) continue;
+
+        dirtyCells[board] |= (position.getPieces(Player::PLAYER_A) ^ shown.getPieces(Player::PLAYER_A)) |
+                             (position.getPieces(Player::PLAYER_B) ^ shown.getPieces(Player::PLAYER_B));
+        //A FEED FASTER THAN THE FRAME RATE SKIPS MOVES. start() THEN FAILS AND THE BOARD SNAPS, SO THE VIEW NEVER
+        //LAGS BEHIND THE GAMES
+        animators[board].start(shown, position);
+        shown = position;
+    }
+}
+
+void SpectatorView::step(int steps) {
+    for (auto &animator: animators) {
+        animator.step(steps);
+    }
+}
+
+void SpectatorView::interpolate(double alpha) {
+    for (int board = 0; board < boardCount; board++) {
+        auto const &animator = animators[board];
+        Bitboard animated = animator.getAnimatedCells();
+        Bitboard changed = dirtyCells[board] | animatedCells[board] | animated;
+        if (!changed) continue;
+
+        for (Bitboard cells = changed & ~animated; cells; cells &= cells - 1) {
+            setRestingPiece(board, std::countr_zero(cells));
+        }
+        for (Bitboard cells = animated; cells; cells &= cells - 1) {
+            int cell = std::countr_zero(cells);
+            auto frame = animator.getFrame(cell, alpha);
+            sf::Vector2f center = centers[board * CELL_COUNT + cell];
+            if (frame.origin >= 0) {
+                center += (centers[board * CELL_COUNT + frame.origin] - center) * (1 - frame.travel);
+            }
+            setPiece(board, cell, center, pieceRadius * frame.scale,
+                     mix(pieceColor(frame.from), pieceColor(frame.to), frame.blend));
+        }
+        animatedCells[board] = animated;
+        dirtyCells[board] = 0;
+
+        //ONE UPLOAD PER BOARD, COVERING ITS FIRST TO LAST CHANGED CELL
+        if (useBuffer) {
+            int first = board * CELL_COUNT + std::countr_zero(changed);
+            int last = board * CELL_COUNT + 63 - std::countl_zero(changed);
+            buffer.update(&vertices[first * VERTICES_PER_CELL], (last - first + 1) * VERTICES_PER_CELL,
+                          first * VERTICES_PER_CELL);
+        }
+    }
+}
+
+void SpectatorView::draw() {
+    window.clear(BACKGROUND_COLOR);
+    if (useBuffer) {
+        window.draw(buffer, 0, vertices.size());
+    } else {
+        window.draw(vertices.data(), vertices.size(), sf::Triangles);
+    }
+}
+
+int SpectatorView::getBoardCount() const {
+    return boardCount;
+}
+
+void SpectatorView::buildGeometry() {
+    auto size = window.getSize();
+    int columns = static_cast<int>(std::ceil(std::sqrt(boardCount)));
+    int rows = (boardCount + columns - 1) / columns;
+    float tileWidth = static_cast<float>(size.x) / columns;
+    float tileHeight = static_cast<float>(size.y) / rows;
+
+    //A BOARD IS 14 HEXAGON SIZES WIDE AND 9 * sqrt(3) HIGH, LEAVE A SMALL MARGIN AROUND EVERY TILE
+    float hexSize = std::min(tileWidth / 14.0f, tileHeight / (9.0f * std::sqrt(3.0f))) * 0.95f;
+    pieceRadius = hexSize * PIECE_RADIUS;
+
+    vertices.assign(static_cast<std::size_t>(boardCount) * CELL_COUNT * VERTICES_PER_CELL, sf::Vertex());
+    centers.assign(static_cast<std::size_t>(boardCount) * CELL_COUNT, sf::Vector2f());
+    for (int board = 0; board < boardCount; board++) {
+        sf::Vector2f tileCenter((board % columns + 0.5f) * tileWidth, (board / columns + 0.5f) * tileHeight);
+
+        for (int cell = 0; cell < CELL_COUNT; cell++) {
+            int column = CELLS.column[cell] - BOARD_COLUMNS / 2;
+            float row = CELLS.row[cell] - (CELLS.columnSize[CELLS.column[cell]] - 1) / 2.0f;
+            sf::Vector2f center = tileCenter + sf::Vector2f(column * 1.5f * hexSize, row * std::sqrt(3.0f) * hexSize);
+
+            centers[board * CELL_COUNT + cell] = center;
+            sf::Vertex *cellVertices = &vertices[(board * CELL_COUNT + cell) * VERTICES_PER_CELL];
+            for (int i = 0; i < 12; i++) {
+                sf::Vector2f corner = HEXAGON_CORNERS[HEXAGON_TRIANGLES[i]];
+                cellVertices[i] = sf::Vertex(center + corner * (hexSize * FIELD_RADIUS), FIELD_COLOR);
+                cellVertices[i + 12] = sf::Vertex(center + corner * pieceRadius, FIELD_COLOR);
+            }
+        }
+    }
+
+    std::fill(shownPositions.begin(), shownPositions.end(), emptyBoard());
+    for (auto &animator: animators) {
+        animator.clear();
+    }
+    std::fill(animatedCells.begin(), animatedCells.end(), 0);
+    std::fill(dirtyCells.begin(), dirtyCells.end(), 0);
+    if (useBuffer) {
+        useBuffer = buffer.create(vertices.size()) && buffer.update(vertices.data());
+    }
+}
+
+void SpectatorView::setPiece(int board, int cell, sf::Vector2f center, float radius, sf::Color color) {
+    sf::Vertex *pieceVertices = &vertices[(board * CELL_COUNT + cell) * VERTICES_PER_CELL + 12];
+    for (int i = 0; i < 12; i++) {
+        pieceVertices[i].position = center + HEXAGON_CORNERS[HEXAGON_TRIANGLES[i]] * radius;
+        pieceVertices[i].color = color;
+    }
+}
+
+void SpectatorView::setRestingPiece(int board, int cell) {
+    setPiece(board, cell, centers[board * CELL_COUNT + cell], pieceRadius,
+             pieceColor(shownPositions[board].getOwner(cell)));
+}
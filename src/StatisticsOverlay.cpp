@@ -0,0 +1,48 @@
+#include "headers/StatisticsOverlay.hpp"
+#include "headers/AllocationCounter.hpp"
+#include <fmt/format.h>
+
+StatisticsOverlay::StatisticsOverlay(sf::RenderWindow &window) : shownFrameAllocations(0), shownMoveAllocations(0),
+                                                                 window(window) {
+    if (!font.loadFromFile("../fonts/Silkscreen-Regular.ttf")) {
+        throw std::runtime_error("Unable to load the font.");
+    }
+
+    text.setFont(font);
+    text.setCharacterSize(14);
+    text.setFillColor(sf::Color::White);
+    text.setPosition(20, 140);
+    text.setString("No search yet\nPress H for a hint");
+
+    allocationText.setFont(font);
+    allocationText.setCharacterSize(14);
+    allocationText.setFillColor(sf::Color::White);
+    allocationText.setPosition(20, 290);
+    allocationText.setString("Allocs/frame 0\nAllocs/move 0");
+}
+
+void StatisticsOverlay::draw() {
+    window.draw(text);
+    if (isAllocationCountingEnabled()) {
+        window.draw(allocationText);
+    }
+}
+
+void StatisticsOverlay::update(SearchStatistics const &statistics) {
+    text.setString(fmt::format("Nodes {}\nNps {:.0f}k\nDepth {}/{}\nEbf {:.2f}\nTT hits {:.0f}%\nTT cuts {:.0f}%\n"
+                               "1st move cuts {:.0f}%\nTime {} ms",
+                               statistics.nodes, statistics.getNodesPerSecond() / 1000, statistics.depth,
+                               statistics.selectiveDepth, statistics.getEffectiveBranchingFactor(),
+                               statistics.getTableHitRate() * 100, statistics.getTableCutoffRate() * 100,
+                               statistics.getFirstMoveCutoffRate() * 100, statistics.microseconds / 1000));
+}
+
+void StatisticsOverlay::updateAllocations(std::uint64_t frameAllocations, std::uint64_t moveAllocations) {
+    //REFORMATTING ALLOCATES, SO AN UNCHANGED COUNT MUST NOT TOUCH THE STRING
+    if (frameAllocations == shownFrameAllocations && moveAllocations == shownMoveAllocations) {
+        return;
+    }
+    shownFrameAllocations = frameAllocations;
+    shownMoveAllocations = moveAllocations;
+    allocationText.setString(fmt::format("Allocs/frame {}\nAllocs/move {}", frameAllocations, moveAllocations));
+}
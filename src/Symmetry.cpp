@@ -0,0 +1,82 @@
+#include "headers/Symmetry.hpp"
+
+namespace {
+    //EVERY BYTE OF A BITBOARD IS MAPPED WITH ONE LOOKUP: bytes[symmetry][byteIndex][byteValue]
+    struct PermutationTables {
+        std::array<std::array<std::array<Bitboard, 256>, 8>, SYMMETRY_COUNT> bytes{};
+    };
+
+    constexpr PermutationTables makePermutationTables() {
+        PermutationTables tables;
+        for (int symmetry = 0; symmetry < SYMMETRY_COUNT; symmetry++) {
+            for (int byteIndex = 0; byteIndex < 8; byteIndex++) {
+                for (int value = 0; value < 256; value++) {
+                    Bitboard mapped = 0;
+                    for (int bit = 0; bit < 8; bit++) {
+                        int cell = byteIndex * 8 + bit;
+                        if ((value & (1 << bit)) && cell < CELL_COUNT) {
+                            mapped |= cellBit(SYMMETRIES[symmetry][cell]);
+                        }
+                    }
+                    tables.bytes[symmetry][byteIndex][value] = mapped;
+                }
+            }
+        }
+        return tables;
+    }
+
+    constexpr PermutationTables PERMUTATIONS = makePermutationTables();
+
+    //THE CANONICAL FORM IS THE IMAGE WITH THE SMALLEST (PLAYER A, PLAYER B) BITBOARD PAIR
+    int findCanonicalImage(Position const &position, Bitboard &bestA, Bitboard &bestB) {
+        Bitboard playerA = position.getPieces(Player::PLAYER_A);
+        Bitboard playerB = position.getPieces(Player::PLAYER_B);
+        bestA = playerA;
+        bestB = playerB;
+        int bestSymmetry = 0;
+
+        for (int symmetry = 1; symmetry < SYMMETRY_COUNT; symmetry++) {
+            Bitboard a = transformBitboard(playerA, symmetry);
+            if (a > bestA) continue;
+            Bitboard b = transformBitboard(playerB, symmetry);
+            if (a < bestA || b < bestB) {
+                bestA = a;
+                bestB = b;
+                bestSymmetry = symmetry;
+            }
+        }
+        return bestSymmetry;
+    }
+}
+
+Bitboard transformBitboard(Bitboard bitboard, int symmetry) {
+    auto const &bytes = PERMUTATIONS.bytes[symmetry];
+    return bytes[0][bitboard & 0xFF] | bytes[1][(bitboard >> 8) & 0xFF] | bytes[2][(bitboard >> 16) & 0xFF] |
+           bytes[3][(bitboard >> 24) & 0xFF] | bytes[4][(bitboard >> 32) & 0xFF] |
+           bytes[5][(bitboard >> 40) & 0xFF] | bytes[6][(bitboard >> 48) & 0xFF] | bytes[7][bitboard >> 56];
+}
+
+Position transformPosition(Position const &position, int symmetry) {
+    return Position::fromBitboards(transformBitboard(position.getPieces(Player::PLAYER_A), symmetry),
+                                   transformBitboard(position.getPieces(Player::PLAYER_B), symmetry),
+                                   position.getSideToMove());
+}
+
+Move transformMove(Move move, int symmetry) {
+    if (move.isNull()) return move;
+    return {static_cast<std::int8_t>(SYMMETRIES[symmetry][move.from]),
+            static_cast<std::int8_t>(SYMMETRIES[symmetry][move.to])};
+}
+
+CanonicalForm canonicalize(Position const &position) {
+    Bitboard bestA, bestB;
+    int symmetry = findCanonicalImage(position, bestA, bestB);
+    return {Position::fromBitboards(bestA, bestB, position.getSideToMove()), symmetry};
+}
+
+CanonicalKey canonicalKey(Position const &position) {
+    Bitboard bestA, bestB;
+    int symmetry = findCanonicalImage(position, bestA, bestB);
+    if (symmetry == 0) return {position.hash(), 0};
+    return {Position::hashBitboards(bestA, bestB, position.getSideToMove()), symmetry};
+}
@@ -0,0 +1,162 @@
+#include "headers/TaskScheduler.hpp"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+namespace {
+    thread_local TaskScheduler *currentScheduler = nullptr;
+    thread_local int currentWorker = -1;
+}
+
+CancellationToken::CancellationToken() : flag(std::make_shared<std::atomic<bool>>(false)) {}
+
+void CancellationToken::cancel() {
+    flag->store(true);
+}
+
+bool CancellationToken::isCancelled() const {
+    return flag->load(std::memory_order_relaxed);
+}
+
+std::atomic<bool> const *CancellationToken::getFlag() const {
+    return flag.get();
+}
+
+TaskScheduler::TaskScheduler(int threadCount) : queuedTasks(0), pendingTasks(0), nextWorker(0), stopping(false) {
+    if (threadCount <= 0) {
+        threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    for (int i = 0; i < threadCount; i++) {
+        workers.push_back(std::make_unique<Worker>());
+    }
+    for (int i = 0; i < threadCount; i++) {
+        threads.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard lock(sleepMutex);
+        stopping = true;
+    }
+    sleepCondition.notify_all();
+    for (auto &thread: threads) {
+        thread.join();
+    }
+}
+
+void TaskScheduler::submit(Task task, TaskPriority priority, CancellationToken token) {
+    //TASKS SPAWNED BY A WORKER STAY ON ITS OWN DEQUE, OTHERS ARE DEALT OUT ROUND ROBIN
+    int index = currentScheduler == this ? currentWorker
+                                          : static_cast<int>(nextWorker++ % static_cast<unsigned>(workers.size()));
+    pendingTasks++;
+    {
+        std::lock_guard lock(workers[index]->mutex);
+        workers[index]->queues[static_cast<int>(priority)].emplace_back(std::move(task), std::move(token));
+    }
+    {
+        std::lock_guard lock(sleepMutex);
+        queuedTasks++;
+    }
+    sleepCondition.notify_one();
+}
+
+void TaskScheduler::post(Task continuation) {
+    std::lock_guard lock(continuationMutex);
+    continuations.push_back(std::move(continuation));
+}
+
+int TaskScheduler::runContinuations() {
+    std::vector<Task> ready;
+    {
+        std::lock_guard lock(continuationMutex);
+        ready.swap(continuations);
+    }
+    for (auto &continuation: ready) {
+        continuation();
+    }
+    return static_cast<int>(ready.size());
+}
+
+void TaskScheduler::wait() {
+    std::pair<Task, CancellationToken> entry;
+    while (pendingTasks > 0) {
+        if (takeTask(-1, entry)) {
+            runTask(entry);
+            continue;
+        }
+        std::unique_lock lock(sleepMutex);
+        doneCondition.wait_for(lock, std::chrono::milliseconds(1), [this] { return pendingTasks == 0; });
+    }
+}
+
+int TaskScheduler::getThreadCount() const {
+    return static_cast<int>(threads.size());
+}
+
+void TaskScheduler::workerLoop(int index) {
+    currentScheduler = this;
+    currentWorker = index;
+
+    std::pair<Task, CancellationToken> entry;
+    while (true) {
+        if (takeTask(index, entry)) {
+            runTask(entry);
+            continue;
+        }
+
+        std::unique_lock lock(sleepMutex);
+        sleepCondition.wait(lock, [this] { return stopping || queuedTasks > 0; });
+        if (stopping && queuedTasks == 0) return;
+    }
+}
+
+bool TaskScheduler::takeTask(int index, std::pair<Task, CancellationToken> &entry) {
+    if (queuedTasks <= 0) return false;
+
+    int count = static_cast<int>(workers.size());
+    for (int priority = 0; priority < TASK_PRIORITY_COUNT; priority++) {
+        if (index >= 0) {
+            Worker &own = *workers[index];
+            std::lock_guard lock(own.mutex);
+            auto &queue = own.queues[priority];
+            if (!queue.empty()) {
+                entry = std::move(queue.back());
+                queue.pop_back();
+                queuedTasks--;
+                return true;
+            }
+        }
+
+        for (int offset = 1; offset <= count; offset++) {
+            int victim = (std::max(index, 0) + offset) % count;
+            if (victim == index) continue;
+            Worker &other = *workers[victim];
+            std::lock_guard lock(other.mutex);
+            auto &queue = other.queues[priority];
+            if (!queue.empty()) {
+                entry = std::move(queue.front());
+                queue.pop_front();
+                queuedTasks--;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::runTask(std::pair<Task, CancellationToken> &entry) {
+    if (!entry.second.isCancelled()) {
+        try {
+            entry.first();
+        } catch (...) {
+            post([error = std::current_exception()] { std::rethrow_exception(error); });
+        }
+    }
+    entry.first = nullptr;
+
+    if (--pendingTasks == 0) {
+        std::lock_guard lock(sleepMutex);
+        doneCondition.notify_all();
+    }
+}
@@ -0,0 +1,77 @@
+#include "headers/ThreatMap.hpp"
+#include <bit>
+
+namespace {
+    Bitboard expand(Bitboard cells, std::array<Bitboard, CELL_COUNT> const &steps) {
+        Bitboard result = cells;
+        for (; cells; cells &= cells - 1) {
+            result |= steps[std::countr_zero(cells)];
+        }
+        return result;
+    }
+}
+
+ThreatMap::ThreatMap() : pieces{0, 0}, sideToMove(Player::PLAYER_A), initialized(false), reachable{0, 0},
+                         captures{}, threats{} {}
+
+void ThreatMap::update(Position const &position) {
+    std::array<Bitboard, 2> current = {position.getPieces(Player::PLAYER_A), position.getPieces(Player::PLAYER_B)};
+    sideToMove = position.getSideToMove();
+
+    Bitboard changed = initialized ? (current[0] ^ pieces[0]) | (current[1] ^ pieces[1]) : ALL_CELLS;
+    pieces = current;
+    initialized = true;
+    if (!changed) return;
+
+    //CAPTURES DEPEND ON NEIGHBOURS, REACH ON CELLS UP TO TWO STEPS AWAY, THREATS ON THE REACH OF NEIGHBOURS
+    Bitboard captureCells = expand(changed, CELLS.neighbours);
+    Bitboard reachCells = expand(captureCells, CELLS.neighbours);
+    Bitboard threatCells = expand(reachCells, CELLS.neighbours);
+    Bitboard empty = ALL_CELLS & ~(pieces[0] | pieces[1]);
+
+    for (Bitboard cells = captureCells; cells; cells &= cells - 1) {
+        int cell = std::countr_zero(cells);
+        captures[0][cell] = static_cast<std::uint8_t>(std::popcount(CELLS.neighbours[cell] & pieces[1]));
+        captures[1][cell] = static_cast<std::uint8_t>(std::popcount(CELLS.neighbours[cell] & pieces[0]));
+    }
+
+    for (int player = 0; player < 2; player++) {
+        reachable[player] &= ~reachCells;
+        for (Bitboard cells = reachCells & empty; cells; cells &= cells - 1) {
+            int cell = std::countr_zero(cells);
+            if ((CELLS.neighbours[cell] | CELLS.jumps[cell]) & pieces[player]) reachable[player] |= cellBit(cell);
+        }
+    }
+
+    for (Bitboard cells = threatCells; cells; cells &= cells - 1) {
+        int cell = std::countr_zero(cells);
+        threats[0][cell] = static_cast<std::uint8_t>(std::popcount(CELLS.neighbours[cell] & reachable[1]));
+        threats[1][cell] = static_cast<std::uint8_t>(std::popcount(CELLS.neighbours[cell] & reachable[0]));
+    }
+}
+
+int ThreatMap::getCaptures(Player player, int cell) const {
+    return captures[playerIndex(player)][cell];
+}
+
+int ThreatMap::getScoreDelta(Move move) const {
+    //EVERY CAPTURE MOVES A POINT FROM THE ENEMY TO US, A CLONE ALSO ADDS A NEW PIECE
+    int gained = 2 * captures[playerIndex(sideToMove)][move.to];
+    return move.isJump() ? gained : gained + 1;
+}
+
+Bitboard ThreatMap::getTargets(int from) const {
+    return (CELLS.neighbours[from] | CELLS.jumps[from]) & ~(pieces[0] | pieces[1]) & ALL_CELLS;
+}
+
+Bitboard ThreatMap::getReachable(Player player) const {
+    return reachable[playerIndex(player)];
+}
+
+int ThreatMap::getThreats(Player player, int cell) const {
+    return (pieces[playerIndex(player)] & cellBit(cell)) ? threats[playerIndex(player)][cell] : 0;
+}
+
+int ThreatMap::playerIndex(Player player) {
+    return player == Player::PLAYER_B ? 1 : 0;
+}
@@ -0,0 +1,51 @@
+#include "headers/ThreatOverlay.hpp"
+#include <algorithm>
+#include <bit>
+
+ThreatOverlay::ThreatOverlay() {
+    if (!font.loadFromFile("../fonts/Silkscreen-Regular.ttf")) {
+        throw std::runtime_error("Unable to load the font.");
+    }
+
+    label.setFont(font);
+    label.setCharacterSize(12);
+    label.setFillColor(sf::Color::Black);
+
+    for (int captures = 0; captures < static_cast<int>(labels.size()); captures++) {
+        for (int delta = 0; delta < static_cast<int>(labels[captures].size()); delta++) {
+            labels[captures][delta] = std::to_string(captures) + "\n+" + std::to_string(delta);
+        }
+    }
+
+    marker.setRadius(8);
+    marker.setOrigin(8, 8);
+}
+
+void ThreatOverlay::draw(sf::RenderTarget &target, ThreatMap const &threatMap, std::vector<Hexagon> const &hexagons,
+                         Player currentPlayer, int source) {
+    //OWN PIECES THE OPPONENT CAN TAKE OVER NEXT TURN, DARKER FOR MORE WAYS TO DO IT
+    for (int cell = 0; cell < CELL_COUNT; cell++) {
+        int threats = threatMap.getThreats(currentPlayer, cell);
+        if (threats == 0) continue;
+
+        marker.setFillColor(sf::Color(255, 140, 0, static_cast<sf::Uint8>(std::min(255, 90 + threats * 40))));
+        marker.setPosition(hexagons[cell].getCenter());
+        target.draw(marker);
+    }
+
+    if (source < 0) {
+        return;
+    }
+
+    //CAPTURES AND POINT SWING FOR EVERY MOVE OF THE SELECTED OR HOVERED PIECE
+    for (Bitboard targets = threatMap.getTargets(source); targets; targets &= targets - 1) {
+        int cell = std::countr_zero(targets);
+        Move move{static_cast<std::int8_t>(source), static_cast<std::int8_t>(cell)};
+
+        label.setString(labels[threatMap.getCaptures(currentPlayer, cell)][threatMap.getScoreDelta(move)]);
+        auto bounds = label.getLocalBounds();
+        label.setOrigin(bounds.left + bounds.width / 2, bounds.top + bounds.height / 2);
+        label.setPosition(hexagons[cell].getCenter());
+        target.draw(label);
+    }
+}
@@ -0,0 +1,90 @@
+#include "headers/TimeManager.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace {
+    //KEPT BACK FOR SENDING THE MOVE AND FOR THE NODES BETWEEN TWO CLOCK CHECKS
+    constexpr std::int64_t MOVE_OVERHEAD_MILLISECONDS = 30;
+    constexpr int MINIMUM_MOVES_TO_GO = 8;
+    //A BEST MOVE THAT TOOK THIS SHARE OF THE LAST ITERATION AND SURVIVED THIS MANY ITERATIONS DOMINATES
+    constexpr double DOMINANT_NODE_SHARE = 0.85;
+    constexpr int DOMINANT_STABLE_ITERATIONS = 3;
+    //HOW MUCH LONGER THAN THE LAST ITERATION THE NEXT ONE IS ASSUMED TO TAKE
+    constexpr double MINIMUM_ITERATION_GROWTH = 2;
+    constexpr double MAXIMUM_ITERATION_GROWTH = 8;
+}
+
+TimeManager::TimeManager() : optimum(0), maximum(0), legalMoves(0), previousScore(0), stableIterations(0),
+                             instability(0), previousNodes(0), previousElapsed(0),
+                             previousIterationMilliseconds(0) {}
+
+void TimeManager::start(Position const &position, std::int64_t remainingMilliseconds,
+                        std::int64_t incrementMilliseconds) {
+    MoveList moves;
+    position.generateMoves(moves);
+    legalMoves = moves.size;
+
+    //THE GAME ENDS WHEN NO CELL IS LEFT. CLONES FILL ONE, JUMPS NONE, SO SELF-PLAY GAMES LAST ABOUT ONE MOVE PER SIDE
+    //FOR EVERY EMPTY CELL
+    int movesToGo = std::max(MINIMUM_MOVES_TO_GO, std::popcount(position.getEmpty()));
+    auto available = std::max<std::int64_t>(1, remainingMilliseconds - MOVE_OVERHEAD_MILLISECONDS);
+
+    optimum = std::min(available / movesToGo + incrementMilliseconds * 3 / 4, available / 2);
+    optimum = std::max<std::int64_t>(1, optimum);
+    maximum = std::max(optimum, std::min(optimum * 4, available * 3 / 4));
+
+    previousBestMove = Move();
+    previousScore = 0;
+    stableIterations = 0;
+    instability = 0;
+    previousNodes = 0;
+    previousElapsed = 0;
+    previousIterationMilliseconds = 0;
+}
+
+std::int64_t TimeManager::getOptimumMilliseconds() const {
+    return optimum;
+}
+
+std::int64_t TimeManager::getMaximumMilliseconds() const {
+    return maximum;
+}
+
+bool TimeManager::shouldStop(SearchResult const &result, std::int64_t elapsedMilliseconds) {
+    if (legalMoves <= 1) return true;
+
+    auto iterationNodes = result.nodes - previousNodes;
+    previousNodes = result.nodes;
+
+    instability *= 0.5;
+    if (!previousBestMove.isNull() && !result.bestMove.isSameAs(previousBestMove)) {
+        instability += 1;
+        stableIterations = 0;
+    } else {
+        stableIterations++;
+    }
+
+    double scale = 1 + instability;
+    //A FALLING SCORE MEANS THE PLANNED LINE RUNS INTO TROUBLE, SO LOOKING DEEPER IS WORTH THE TIME
+    if (!previousBestMove.isNull() && result.score < previousScore - MATERIAL_WEIGHT) {
+        scale *= 1.5;
+    }
+    double share = iterationNodes == 0 ? 0 : static_cast<double>(result.bestMoveNodes) /
+                                             static_cast<double>(iterationNodes);
+    if (stableIterations >= DOMINANT_STABLE_ITERATIONS && share > DOMINANT_NODE_SHARE) {
+        scale *= 0.4;
+    }
+    previousBestMove = result.bestMove;
+    previousScore = result.score;
+
+    //AN ITERATION CUT OFF BY THE MAXIMUM IS THROWN AWAY, SO THE NEXT ONE IS ONLY STARTED WHEN IT IS EXPECTED TO END
+    //WITHIN THE BUDGET. ITS LENGTH IS GUESSED FROM HOW MUCH THE LAST ITERATION GREW OVER THE ONE BEFORE.
+    auto iterationMilliseconds = static_cast<double>(elapsedMilliseconds - previousElapsed);
+    double growth = previousIterationMilliseconds > 0 ? iterationMilliseconds / previousIterationMilliseconds : 0;
+    growth = std::clamp(growth, MINIMUM_ITERATION_GROWTH, MAXIMUM_ITERATION_GROWTH);
+    previousElapsed = elapsedMilliseconds;
+    previousIterationMilliseconds = iterationMilliseconds;
+
+    auto budget = std::min(static_cast<double>(maximum), static_cast<double>(optimum) * scale);
+    return static_cast<double>(elapsedMilliseconds) + iterationMilliseconds * growth > budget;
+}
@@ -0,0 +1,53 @@
+#include "headers/TranspositionTable.hpp"
+#include <algorithm>
+#include <bit>
+
+TranspositionTable::TranspositionTable(std::size_t megabytes) : mask(0), generation(1) {
+    resize(megabytes);
+}
+
+void TranspositionTable::resize(std::size_t megabytes) {
+    std::size_t count = megabytes * 1024 * 1024 / sizeof(TranspositionEntry);
+    count = count < 1024 ? 1024 : std::bit_floor(count);
+
+    entries.assign(count, TranspositionEntry());
+    mask = count - 1;
+}
+
+void TranspositionTable::clear() {
+    std::fill(entries.begin(), entries.end(), TranspositionEntry());
+    generation = 1;
+}
+
+void TranspositionTable::invalidate() {
+    generation++;
+    if (generation == 0) {
+        clear();
+    }
+}
+
+bool TranspositionTable::probe(std::uint64_t key, TranspositionEntry &entry) const {
+    auto const &slot = entries[key & mask];
+    if (slot.key != key || slot.generation != generation || slot.bound == BoundType::NONE) {
+        return false;
+    }
+    entry = slot;
+    return true;
+}
+
+void TranspositionTable::store(std::uint64_t key, Move move, int score, int depth, BoundType bound) {
+    auto &slot = entries[key & mask];
+    if (slot.generation == generation && slot.key == key && slot.depth > depth && bound != BoundType::EXACT) {
+        return;
+    }
+    if (move.isNull() && slot.key == key && slot.generation == generation) {
+        move = slot.move;
+    }
+
+    slot.key = key;
+    slot.move = move;
+    slot.score = static_cast<std::int16_t>(score);
+    slot.depth = static_cast<std::uint8_t>(depth);
+    slot.bound = bound;
+    slot.generation = generation;
+}
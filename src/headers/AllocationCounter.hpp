@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+//GLOBAL operator new/delete ARE ONLY REPLACED WHEN BUILT WITH HEXXAGON_COUNT_ALLOCATIONS,
+//OTHERWISE THE COUNTS STAY AT ZERO AND isAllocationCountingEnabled() IS FALSE
+bool isAllocationCountingEnabled();
+
+//ALLOCATIONS MADE BY ALL THREADS SINCE THE START OF THE PROGRAM
+std::uint64_t getAllocationCount();
+
+std::uint64_t getAllocatedBytes();
+
+//ALLOCATIONS MADE BY THE CALLING THREAD ONLY, SO A SCOPE IS NOT BLAMED FOR WORK ON OTHER THREADS
+std::uint64_t getThreadAllocationCount();
+
+class AllocationScope {
+public:
+    AllocationScope();
+
+    std::uint64_t getAllocations() const;
+
+private:
+    std::uint64_t startCount;
+};
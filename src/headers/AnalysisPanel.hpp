@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Analyzer.hpp"
+#include <SFML/Graphics.hpp>
+
+class AnalysisPanel {
+public:
+    AnalysisPanel(sf::RenderWindow &window);
+
+    void draw();
+
+    //CLEARS THE LINES OF THE PREVIOUS POSITION WHILE THE FIRST ITERATION ON position RUNS
+    void reset(Position const &position);
+
+    void update(AnalysisSnapshot const &snapshot);
+
+private:
+    sf::Font font;
+    sf::Text text;
+    sf::RenderWindow &window;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Position.hpp"
+#include "Search.hpp"
+#include "TaskScheduler.hpp"
+#include <cstdint>
+#include <mutex>
+
+//A SLICE SEARCHES THIS LONG BEFORE THE ANALYSIS GOES BACK TO THE END OF THE BACKGROUND QUEUE
+constexpr std::int64_t ANALYSIS_SLICE_MILLISECONDS = 250;
+
+//WHAT THE ANALYZER HAD FOUND WHEN IT LAST PUBLISHED. version GROWS WITH EVERY PUBLISHED ITERATION.
+struct AnalysisSnapshot {
+    std::uint64_t version = 0;
+    Position position;
+    SearchResult result;
+    std::uint64_t nodes = 0;
+    double nodesPerSecond = 0;
+};
+
+//INFINITE MULTI-PV ANALYSIS AS BACKGROUND TASKS OF THE SHARED SCHEDULER: EVERY SLICE SEARCHES FOR
+//ANALYSIS_SLICE_MILLISECONDS AND RESUBMITS ITSELF, SO UI_CRITICAL TASKS LIKE HINTS GET A WORKER BETWEEN SLICES AND
+//NO CORE IS TAKEN BEYOND THE SCHEDULER'S OWN. THE TRANSPOSITION TABLE IS KEPT ACROSS SLICES AND RESTARTS, SO A SLICE
+//REACHES THE DEPTH OF THE LAST ONE QUICKLY AND ONLY DEEPER ITERATIONS ARE PUBLISHED. analyze() ONLY SUBMITS AND
+//poll() ONLY TRY-LOCKS THE PUBLISHED SNAPSHOT, SO THE CALLER NEVER WAITS FOR THE SEARCH.
+class Analyzer {
+public:
+    Analyzer(TaskScheduler &scheduler, std::size_t hashMegabytes, int lineCount);
+
+    //CANCELS THE ANALYSIS AND WAITS FOR THE SCHEDULER, WHICH HAS TO OUTLIVE THE ANALYZER
+    ~Analyzer();
+
+    Analyzer(Analyzer const &) = delete;
+
+    Analyzer &operator=(Analyzer const &) = delete;
+
+    //STOPS THE CURRENT ANALYSIS AND STARTS ON position
+    void analyze(Position const &position);
+
+    void stop();
+
+    //COPIES THE SNAPSHOT WHEN IT IS NEWER THAN snapshot. FALSE WHEN THERE IS NOTHING NEW OR THE SEARCH IS PUBLISHING
+    //AT THIS VERY MOMENT, THE NEXT CALL GETS IT THEN
+    bool poll(AnalysisSnapshot &snapshot);
+
+private:
+    TaskScheduler &scheduler;
+    Search search;
+    int lineCount;
+    //A CANCELLED SLICE MAY STILL BE RUNNING WHEN THE NEXT ANALYSIS STARTS, ONLY ONE OF THEM USES search AT A TIME
+    std::mutex searchMutex;
+    CancellationToken token;
+    std::mutex snapshotMutex;
+    AnalysisSnapshot published;
+
+    void submitSlice(Position const &position, CancellationToken const &sliceToken, std::uint64_t nodes);
+
+    void runSlice(Position const &position, CancellationToken const &sliceToken, std::uint64_t nodes);
+};
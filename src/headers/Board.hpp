@@ -1,55 +1,120 @@
 #pragma once
 
+#include "CellAnimator.hpp"
 #include "Enums.hpp"
 #include "Hexagon.hpp"
 #include "Counter.hpp"
+#include "GameClock.hpp"
+#include "Position.hpp"
+#include "TaskScheduler.hpp"
+#include "ThreatMap.hpp"
+#include "ThreatOverlay.hpp"
 #include <SFML/Graphics.hpp>
 #include <cmath>
 #include <iostream>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
+
+constexpr std::int64_t CLOCK_BASE_MILLISECONDS = 5 * 60 * 1000;
+constexpr std::int64_t CLOCK_INCREMENT_MILLISECONDS = 3000;
+constexpr char const *SAVE_DIRECTORY = "../saved";
 
 class Board {
 public:
-    Board(int rows, int cols, float hexSize, sf::RenderWindow &window);
+    //save() AND load() USE saveDirectory, TOOLS PASS THEIR OWN SO THEY NEVER TOUCH THE PLAYER'S SAVED GAMES
+    Board(int rows, int cols, float hexSize, sf::RenderWindow &window,
+          std::filesystem::path saveDirectory = SAVE_DIRECTORY);
 
     void start();
 
     void draw();
 
-    void save();
+    //THE SAME FRAME INTO ANY TARGET, E.G. AN OFFSCREEN sf::RenderTexture
+    void draw(sf::RenderTarget &target);
+
+    //RETURNS THE FILE NAME load() ACCEPTS, THE FILE ITSELF IS WRITTEN ON A WORKER
+    std::string save(TaskScheduler &scheduler);
+
+    //WRITES EVERY SAVE STILL WAITING FOR ITS WORKER ON THE CALLING THREAD. RETURNS ONCE ALL OF THEM ARE ON DISK,
+    //INCLUDING ONES ANOTHER THREAD IS WRITING AT THE TIME, SO A SCAN OF THE SAVE DIRECTORY AFTER IT SEES THEM.
+    void flushSaves();
 
     void load(std::string const &fileName);
 
     void onMouseClick(float mouseX, float mouseY);
 
+    void onMouseMove(float mouseX, float mouseY);
+
+    void toggleThreats();
+
+    //ONE FIXED SIMULATION STEP OF THE MOVE ANIMATIONS
+    void step();
+
+    //POSES THE ANIMATED PIECES alpha OF A STEP PAST THE LAST step(), CALLED ONCE PER FRAME BEFORE draw()
+    void interpolate(double alpha);
+
+    //CALLED EVERY FRAME: REFRESHES THE CLOCKS NEXT TO THE COUNTERS AND ENDS THE GAME WHEN A PLAYER RUNS OUT OF TIME
+    void updateClock();
+
+    void pauseClock();
+
+    void resumeClock();
+
+    Position getPosition();
+
+    int getPoints(Player player) const;
+
+    //TRUE ONCE checkForWinner HAS DECIDED THE GAME, UNTIL THE NEXT start()
+    bool isFinished() const;
+
+    //WHERE A CLICK SELECTS THE CELL, IN WINDOW COORDINATES
+    sf::Vector2f getCellCenter(int cell) const;
+
+    void showHint(Move move);
+
 private:
     int rows, cols, playerAPoints, playerBPoints, emptyFields;
     float hexSize;
     sf::RenderWindow &window;
-    std::vector<std::vector<Hexagon>> hexagons;
+    std::filesystem::path saveDirectory;
+    sf::Vector2u geometrySize;
+    std::vector<Hexagon> hexagons;
     Counter playerACounter, playerBCounter;
+    GameClock clock;
     Player currentPlayer;
+    ThreatMap threatMap;
+    ThreatOverlay threatOverlay;
+    bool threatsVisible;
+    int hoveredCell;
+    bool finished;
+    CellAnimator animator;
+    Bitboard shownAnimatedCells;
+    std::mutex saveMutex;
+    //FILE NAME AND CONTENT OF SAVES NOT WRITTEN YET
+    std::vector<std::pair<std::string, std::string>> pendingSaves;
 
     void initializeHexagons();
 
     void changePlayer();
 
-    Hexagon &getHexagon(int column, int row);
-
     void prepareForNextMove();
 
     Hexagon &getSelectedHexagon();
 
-    std::pair<int, int> getSelectedHexagonBoardPosition();
+    int getSelectedCell();
 
     void calculatePoints();
 
+    void updateThreats();
+
     void checkForWinner();
 
     void resetStates();
 
-    void setAdjacentHexagons(int column, int row, AdjacentHexagonsMode mode);
+    void setAdjacentHexagons(int cell, AdjacentHexagonsMode mode);
 
     void setHexagonJumpOptions();
+
+    void stopAnimations();
 };
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Enums.hpp"
+#include "Position.hpp"
+#include <array>
+#include <cstdint>
+
+//HOW THE PIECE OF ONE ANIMATED CELL IS DRAWN IN THIS FRAME
+struct PieceFrame {
+    Player from, to;
+    //0 SHOWS THE COLOUR OF from, 1 THE COLOUR OF to
+    float blend;
+    //OF THE RADIUS OF A PIECE AT REST
+    float scale;
+    //THE CELL THE PIECE TRAVELS FROM, -1 WHEN IT STAYS ON ITS OWN CELL
+    int origin;
+    //0 AT origin, 1 ON THE CELL ITSELF
+    float travel;
+};
+
+//FIXED-STEP ANIMATIONS OF THE CELLS ONE MOVE CHANGED. THE RULES APPLY A MOVE AT ONCE, THIS ONLY DECIDES HOW THE
+//CHANGED CELLS ARE DRAWN UNTIL THEY SETTLE: THE MOVED PIECE TRAVELS TO ITS TARGET, A JUMP SOURCE SHRINKS AWAY AND
+//THE CAPTURED PIECES FLIP ONCE THE MOVER HAS LANDED. EVERY OTHER CELL IS DRAWN AT REST.
+class CellAnimator {
+public:
+    CellAnimator();
+
+    //A NEW MOVE SETTLES WHAT IS STILL RUNNING. FALSE, AND NOTHING ANIMATED, WHEN after IS NOT ONE MOVE AWAY FROM
+    //before, E.G. A NEW GAME OR SEVERAL MOVES AT ONCE. origin PICKS THE PARENT OF A CLONE, ANY NEIGHBOUR BY DEFAULT
+    bool start(Position const &before, Position const &after, int origin = -1);
+
+    //steps FIXED STEPS AT ONCE, THE COST DOES NOT DEPEND ON steps
+    void step(int steps = 1);
+
+    void clear();
+
+    Bitboard getAnimatedCells() const;
+
+    //alpha IS THE FRACTION OF THE NEXT STEP ALREADY ELAPSED, SEE FixedTimestep::getAlpha()
+    PieceFrame getFrame(int cell, double alpha) const;
+
+private:
+    struct Animation {
+        CellAnimationType type;
+        Player from, to;
+        std::int8_t origin;
+        std::int16_t delay, duration, elapsed;
+    };
+
+    std::array<Animation, CELL_COUNT> animations;
+    Bitboard animatedCells;
+
+    void add(int cell, CellAnimationType type, Player from, Player to, int origin, int delay, int duration);
+};
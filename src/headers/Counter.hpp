@@ -1,19 +1,37 @@
 #pragma once
 
 #include "Enums.hpp"
+#include "Position.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <SFML/Graphics.hpp>
 
+//LONG ENOUGH FOR "9999:59"
+constexpr std::size_t CLOCK_LABEL_LENGTH = 8;
+
 class Counter {
 public:
     Counter(sf::RenderWindow &window, Player player);
 
-    void draw();
+    void draw(sf::RenderTarget &target);
 
     void updatePoints(int points);
 
+    //THE RUNNING CLOCK IS DRAWN IN THE PLAYER'S COLOR, A STOPPED ONE IN GRAY
+    void updateClock(std::int64_t milliseconds, bool running);
+
 private:
     sf::Font font;
     sf::Text text;
+    sf::Text clockText;
+    sf::Color playerColor;
     Player owningPlayer;
-    sf::RenderWindow &window;
+    //EVERY POSSIBLE LABEL IS BUILT ONCE, SO A MOVE ONLY COPIES INTO THE TEXT'S EXISTING BUFFER
+    std::array<sf::String, CELL_COUNT + 1> labels;
+    //THE CLOCK HAS TOO MANY VALUES TO BUILD THEM ALL, SO ONE LABEL OF FIXED LENGTH IS OVERWRITTEN IN PLACE
+    sf::String clockLabel;
+    int shownPoints;
+    std::int64_t shownClock;
+    bool shownRunning;
 };
\ No newline at end of file
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Board.hpp"
+#include "Position.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//DRIVES THE LEGACY Board WITH CLICKS AT CELL CENTRES AND CHECKS AFTER EVERY CLICK THAT ITS POSITION, POINTS AND
+//GAME-OVER VERDICT MATCH Position. EVERY ATTEMPTED MOVE IS ALSO REPLAYED WITH THE BASELINE Board's OWN PER-COLUMN
+//ADJACENCY AND JUMP RULES, SINCE TODAY'S Board READS THE SAME CELLS TABLES AS Position. THE WINDOW NEVER HAS TO BE
+//OPENED, Board ONLY READS ITS SIZE AND CLOSES IT. A MISMATCH THROWS std::runtime_error DESCRIBING BOTH SIDES.
+class DifferentialHarness {
+public:
+    explicit DifferentialHarness(sf::RenderWindow &window);
+
+    void startGame();
+
+    //CELLS OUTSIDE 0..CELL_COUNT-1 CLICK NEXT TO THE BOARD
+    void click(int cell);
+
+    //THE TWO CLICKS A PLAYER MAKES FOR move
+    void playMove(Move move);
+
+    //FUZZER INPUT: A BYTE WITH THE HIGH BIT SET PLAYS THE LEGAL MOVE CHOSEN BY THE NEXT BYTE, ANY OTHER BYTE IS A
+    //SINGLE CLICK ON CELL byte % 64. A NEW GAME STARTS WHEN ONE ENDS.
+    void playBytes(std::uint8_t const *data, std::size_t size);
+
+    //TERMINAL FOR THE ENGINE: DECIDED, OR THE SIDE TO MOVE IS STUCK
+    bool isGameOver() const;
+
+    Position const &getPosition() const;
+
+    std::uint64_t getClickCount() const;
+
+    std::uint64_t getMoveCount() const;
+
+private:
+    Board board;
+    Position position;
+    //THE MODEL OF THE LEGACY SELECTION: THE OWN PIECE CLICKED LAST, -1 AFTER A MOVE OR ANY OTHER CLICK
+    int selected;
+    std::uint64_t clickCount, moveCount;
+
+    //LEGALITY AND RESULT OF selected->cell UNDER THE BASELINE RULES AGAINST Position; TRUE IF THE MOVE IS LEGAL
+    bool checkBaselineRules(int cell);
+
+    void compare(int cell);
+};
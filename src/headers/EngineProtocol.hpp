@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Position.hpp"
+#include "Search.hpp"
+#include "TimeManager.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+//LINE-BASED PROTOCOL IN THE SPIRIT OF UCI. THE CALLING THREAD ONLY READS COMMANDS, SEARCHES RUN ON THEIR OWN
+//THREAD SO THAT stop AND ponderhit ARE HANDLED WHILE THE ENGINE IS THINKING.
+class EngineProtocol {
+public:
+    EngineProtocol(std::istream &input, std::ostream &output);
+
+    ~EngineProtocol();
+
+    void run();
+
+private:
+    std::istream &input;
+    std::ostream &output;
+    std::mutex outputMutex;
+    Search search;
+    TimeManager timeManager;
+    Position position;
+    std::thread searchThread;
+    std::atomic<bool> stopSignal, ponderSignal;
+    std::mutex waitMutex;
+    std::condition_variable waitForRelease;
+    bool holdBestMove;
+    int multiPv;
+
+    bool handle(std::string const &line);
+
+    void send(std::string const &line);
+
+    void setOption(std::istringstream &arguments);
+
+    void setPosition(std::istringstream &arguments);
+
+    void go(std::istringstream &arguments);
+
+    void searchAndReport(SearchLimits limits);
+
+    void reportIteration(SearchResult const &result, SearchStatistics const &statistics);
+
+    void releaseBestMove();
+
+    void stopSearch();
+};
@@ -1,6 +1,6 @@
 #pragma once
 
-enum class Player {
+enum class Player : unsigned char {
     NO_PLAYER,
     PLAYER_A,
     PLAYER_B
@@ -23,4 +23,40 @@ enum class GameState {
     Game,
     Paused,
     SavedGamesMenu
-};
\ No newline at end of file
+};
+
+enum class BoundType : unsigned char {
+    NONE,
+    EXACT,
+    LOWER_BOUND,
+    UPPER_BOUND
+};
+
+enum class PositionFormat {
+    AUTO,
+    TEXT,
+    BINARY
+};
+
+enum class EvaluationKernel {
+    SCALAR,
+    SSE4,
+    AVX2
+};
+
+enum class TaskPriority {
+    UI_CRITICAL,
+    BACKGROUND
+};
+
+enum class CellAnimationType : unsigned char {
+    CLONE,
+    JUMP,
+    VACATE,
+    FLIP
+};
+
+enum class DatabaseAccess {
+    READ_ONLY,
+    READ_WRITE
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Enums.hpp"
+#include "Position.hpp"
+
+constexpr int WIN_SCORE = 30000;
+constexpr int MAX_PLY = 128;
+//NO EVALUATION MAY LOOK LIKE A WIN SCORE, OR SEARCH WOULD TREAT IT AS A FORCED RESULT
+constexpr int MAX_EVALUATION = WIN_SCORE - MAX_PLY - 1;
+constexpr int EVALUATION_BATCH_SIZE = 16;
+
+//ONE PIECE IS WORTH MATERIAL_WEIGHT, THE OTHER TERMS ARE DIFFERENCES BETWEEN THE SIDE TO MOVE AND THE OPPONENT
+constexpr int MATERIAL_WEIGHT = 16;
+constexpr int MOBILITY_WEIGHT = 2;
+constexpr int FRONTIER_WEIGHT = -2;
+constexpr int OWN_CAPTURE_WEIGHT = 8;
+constexpr int ENEMY_CAPTURE_WEIGHT = -4;
+
+//SCORES ARE ALWAYS FROM THE POINT OF VIEW OF THE SIDE TO MOVE
+int evaluate(Position const &position);
+
+//SAME SCORES AS evaluate, EVALUATION_BATCH_SIZE POSITIONS AT A TIME IN THE SIMD LANES OF THE KERNEL THE CPU SUPPORTS.
+//WITH AN N-TUPLE NETWORK LOADED THE KERNELS SUM ITS WEIGHTS, OTHERWISE THEY COMPUTE THE HAND-WRITTEN EVALUATION.
+//Search EVALUATES ONE LEAF AT A TIME AND DOES NOT USE IT, SO A CUTOFF NEVER PAYS FOR SIBLINGS IT WOULD HAVE SKIPPED
+void evaluateBatch(Position const *positions, int count, int *scores);
+
+EvaluationKernel getEvaluationKernel();
+
+void setEvaluationKernel(EvaluationKernel kernel);
+
+int evaluateBitboards(Bitboard own, Bitboard enemy);
+
+bool isTerminal(Position const &position);
+
+//ONLY MEANINGFUL FOR TERMINAL POSITIONS
+int finalPointsDifference(Position const &position);
+
+int terminalScore(Position const &position, int ply);
+
+bool isWinScore(int score);
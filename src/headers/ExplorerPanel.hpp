@@ -0,0 +1,24 @@
+#pragma once
+
+#include "GameDatabase.hpp"
+#include <SFML/Graphics.hpp>
+
+class ExplorerPanel {
+public:
+    ExplorerPanel(sf::RenderWindow &window);
+
+    void draw();
+
+    //ONLY QUERIES THE DATABASE WHEN THE POSITION CHANGED SINCE THE LAST CALL
+    void update(GameDatabase const &database, Position const &position);
+
+    //FOR A MISSING OR OUTDATED DATABASE
+    void showUnavailable();
+
+private:
+    sf::Font font;
+    sf::Text text;
+    sf::RenderWindow &window;
+    std::uint64_t shownKey;
+    bool hasShownKey;
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+//EXCLUSIVE ADVISORY LOCK ON A FILE BETWEEN PROCESSES, HELD UNTIL unlock OR DESTRUCTION. flock ON POSIX,
+//LockFileEx ON WINDOWS. THE FILE IS CREATED IF IT DOES NOT EXIST AND IS NEVER WRITTEN.
+class FileLock {
+public:
+    FileLock();
+
+    ~FileLock();
+
+    FileLock(FileLock const &) = delete;
+
+    FileLock &operator=(FileLock const &) = delete;
+
+    //RETURNS FALSE WITHOUT WAITING IF ANOTHER PROCESS HOLDS THE LOCK
+    bool tryLock(std::string const &path);
+
+    void unlock();
+
+private:
+#ifdef _WIN32
+    void *file;
+#else
+    int fd;
+#endif
+};
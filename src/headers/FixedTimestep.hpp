@@ -0,0 +1,32 @@
+#pragma once
+
+#include <chrono>
+
+constexpr int SIMULATION_STEPS_PER_SECOND = 120;
+
+//HANDS REAL TIME OUT IN FIXED STEPS, SO THE SIMULATION RUNS AT THE SAME SPEED WHATEVER THE FRAME RATE. THE TIME LEFT
+//OVER IS getAlpha(), HOW FAR THE FRAME LIES BETWEEN THE LAST SIMULATED STEP AND THE NEXT ONE.
+class FixedTimestep {
+public:
+    explicit FixedTimestep(int stepsPerSecond = SIMULATION_STEPS_PER_SECOND);
+
+    //STEPS TO SIMULATE FOR THE REAL TIME SINCE THE LAST CALL
+    int advance();
+
+    //THE SAME FOR A GIVEN FRAME TIME. A FRAME LONGER THAN A QUARTER SECOND (A STALL, A DRAGGED WINDOW) COUNTS AS A
+    //QUARTER SECOND, SO ONE LONG FRAME CANNOT SNOWBALL INTO EVER MORE STEPS
+    int advance(double elapsedSeconds);
+
+    double getAlpha() const;
+
+    //SIMULATED SECONDS PER REAL SECOND
+    void setTimeScale(double scale);
+
+    double getTimeScale() const;
+
+    void reset();
+
+private:
+    double stepSeconds, accumulator, timeScale;
+    std::chrono::steady_clock::time_point lastAdvance;
+};
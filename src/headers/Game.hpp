@@ -1,14 +1,27 @@
 #pragma once
 
+#include "AnalysisPanel.hpp"
+#include "Analyzer.hpp"
 #include "Board.hpp"
+#include "ExplorerPanel.hpp"
+#include "FixedTimestep.hpp"
+#include "GameDatabase.hpp"
 #include "PauseMenu.hpp"
 #include "Menu.hpp"
 #include "SavedGamesMenu.hpp"
+#include "Search.hpp"
+#include "StatisticsOverlay.hpp"
+#include "TaskScheduler.hpp"
+#include <memory>
+#include <mutex>
 
 class Game {
 public:
     Game(sf::RenderWindow &window);
 
+    //THE ANALYZER IS DESTROYED FIRST, WHILE THE SCHEDULER ITS SLICES RUN ON STILL EXISTS
+    ~Game();
+
     void run();
 
     void switchToGame();
@@ -23,6 +36,19 @@ public:
 
     void loadGame(std::string const& fileName);
 
+    void showHint();
+
+    void toggleAnalysis();
+
+    //THE DATABASE IS OPENED READ-ONLY THE FIRST TIME THE EXPLORER IS SHOWN, WRITERS LIKE THE SERVER OWN IT
+    void toggleExplorer();
+
+    bool isAnalysing() const;
+
+    TaskScheduler &getScheduler();
+
+    Board &getBoard();
+
 private:
     sf::RenderWindow &window;
     GameState gameState;
@@ -30,4 +56,25 @@ private:
     Menu mainMenu;
     PauseMenu pauseMenu;
     SavedGamesMenu savedGamesMenu;
+    Search engine;
+    StatisticsOverlay statisticsOverlay;
+    bool statisticsVisible;
+    std::uint64_t moveAllocations;
+    std::unique_ptr<GameDatabase> database;
+    ExplorerPanel explorerPanel;
+    bool explorerVisible;
+    //CREATED THE FIRST TIME ANALYSIS IS SWITCHED ON, ITS TABLE IS LARGE
+    std::unique_ptr<Analyzer> analyzer;
+    AnalysisPanel analysisPanel;
+    bool analysing;
+    std::uint64_t analysedKey;
+    AnalysisSnapshot analysis;
+    sf::Clock analysisPollClock;
+    FixedTimestep timestep;
+    std::mutex engineMutex;
+    CancellationToken hintToken;
+    //DECLARED LAST SO ITS WORKERS ARE JOINED BEFORE ANYTHING THEIR TASKS USE IS DESTROYED
+    TaskScheduler scheduler;
+
+    void updateAnalysis();
 };
\ No newline at end of file
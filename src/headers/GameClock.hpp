@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Enums.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+//CHESS-STYLE CLOCK: EVERY PLAYER STARTS WITH THE BASE TIME AND GETS THE INCREMENT AFTER EACH OF THEIR MOVES.
+//ONLY THE RUNNING PLAYER'S TIME GOES DOWN, MEASURED WITH THE MONOTONIC steady_clock.
+class GameClock {
+public:
+    GameClock(std::int64_t baseMilliseconds, std::int64_t incrementMilliseconds);
+
+    //BOTH PLAYERS BACK TO THE BASE TIME, NOBODY RUNNING
+    void reset();
+
+    void start(Player player);
+
+    //ENDS THE RUNNING PLAYER'S MOVE: ADDS THE INCREMENT AND STARTS THE OPPONENT
+    void press();
+
+    void stop();
+
+    std::int64_t getRemainingMilliseconds(Player player) const;
+
+    std::int64_t getIncrementMilliseconds() const;
+
+    Player getRunningPlayer() const;
+
+    //THE PLAYER WHOSE TIME HAS RUN OUT, NO_PLAYER WHILE BOTH HAVE TIME LEFT
+    Player getFlaggedPlayer() const;
+
+    //"4:59" FROM TEN SECONDS UP, "9.3" BELOW. WRITES AT MOST size CHARACTERS WITHOUT ALLOCATING AND RETURNS HOW MANY
+    static std::size_t format(std::int64_t milliseconds, char *buffer, std::size_t size);
+
+private:
+    std::int64_t baseMilliseconds, incrementMilliseconds;
+    std::array<std::int64_t, 2> remaining;
+    Player runningPlayer;
+    std::chrono::steady_clock::time_point turnStart;
+
+    static int playerIndex(Player player);
+};
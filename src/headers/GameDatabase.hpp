@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Enums.hpp"
+#include "FileLock.hpp"
+#include "MappedFile.hpp"
+#include "Position.hpp"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+//games.hxg: "HXGD", A LITTLE-ENDIAN uint32 VERSION AND A RANDOM uint64 DATABASE ID, FOLLOWED BY APPEND-ONLY RECORDS -
+//LITTLE-ENDIAN uint16 MOVE COUNT, uint8 WINNER (0 DRAW, 1 A, 2 B) AND TWO BYTES (FROM, TO) PER MOVE. EVERY GAME
+//STARTS FROM THE START POSITION.
+//games.hxi: MEMORY-MAPPED OPEN ADDRESSING TABLE FROM THE CANONICAL POSITION KEY TO RESULT COUNTS. IT IS DERIVED
+//DATA - A MISSING INDEX, ONE CARRYING ANOTHER DATABASE ID, ONE LEFT HALFWAY THROUGH A GAME BY A CRASH OR AN OUTDATED
+//ONE IS REBUILT OR CAUGHT UP FROM games.hxg WHEN A WRITER OPENS THE DATABASE.
+//games.lock: HELD WITH AN EXCLUSIVE flock BY THE ONE WRITER. ONLY IT APPENDS, REPAIRS, CATCHES UP OR GROWS THE FILES.
+//READERS TAKE NO LOCK, NEVER WRITE, AND REMAP THE INDEX WHEN THE WRITER REPLACES IT.
+constexpr char GAME_DATABASE_MAGIC[] = "HXGD";
+constexpr char GAME_INDEX_MAGIC[] = "HXIX";
+
+//COUNTS ARE FROM THE POINT OF VIEW OF THE SIDE TO MOVE IN THE POSITION. A GAME COUNTS ONCE HOWEVER OFTEN IT PASSES
+//THROUGH THE POSITION, lastPly IS WHERE IT FIRST DID.
+struct PositionStatistics {
+    std::uint32_t games = 0;
+    std::uint32_t wins = 0;
+    std::uint32_t losses = 0;
+    std::uint64_t lastGame = 0;
+    std::uint32_t lastPly = 0;
+
+    std::uint32_t getDraws() const;
+
+    double getWinRate() const;
+};
+
+//THE STATISTICS OF THE POSITION THE MOVE LEADS TO, FROM THE POINT OF VIEW OF THE PLAYER MAKING THE MOVE. THEY ARE
+//POSITION STATISTICS, NOT MOVE STATISTICS: EVERY GAME REACHING THAT POSITION COUNTS, BY WHATEVER MOVE ORDER.
+struct ContinuationStatistics {
+    Move move;
+    PositionStatistics statistics;
+};
+
+class GameDatabase {
+public:
+    //THROWS std::runtime_error IF ANOTHER PROCESS ALREADY HAS THE DATABASE OPEN READ_WRITE, OR FOR READ_ONLY IF IT
+    //DOES NOT EXIST OR ITS INDEX IS OUTDATED
+    explicit GameDatabase(std::string const &directory, DatabaseAccess access = DatabaseAccess::READ_WRITE);
+
+    //RETURNS THE OFFSET OF THE GAME RECORD, THROWS std::runtime_error ON AN ILLEGAL MOVE OR IF games.hxg HOLDS A
+    //DAMAGED RECORD THE NEW ONE WOULD OVERWRITE
+    std::uint64_t addGame(std::vector<Move> const &moves, Player winner);
+
+    std::vector<Move> readGame(std::uint64_t offset, Player &winner);
+
+    bool lookup(Position const &position, PositionStatistics &statistics) const;
+
+    //MOVES LEADING TO POSITIONS IN THE DATABASE, MOST COMMON POSITION FIRST
+    std::vector<ContinuationStatistics> getContinuations(Position const &position) const;
+
+    std::uint64_t getGameCount() const;
+
+private:
+    struct IndexHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint64_t capacity;
+        std::uint64_t used;
+        std::uint64_t indexedBytes;
+        std::uint64_t games;
+        std::uint32_t byteOrder;
+        std::uint32_t reserved;
+        //THE ID FROM THE HEADER OF THE games.hxg THIS INDEX WAS BUILT FROM
+        std::uint64_t database;
+        //OFFSET OF THE GAME indexGame IS ADDING, 0 BETWEEN GAMES. NONZERO WHEN A WRITER OPENS THE DATABASE MEANS
+        //THE LAST ONE DIED WITH THAT GAME PARTLY COUNTED.
+        std::uint64_t indexingGame;
+    };
+
+    struct IndexSlot {
+        std::uint64_t key;
+        std::uint32_t games;
+        std::uint32_t wins;
+        std::uint32_t losses;
+        std::uint32_t lastPly;
+        std::uint64_t lastGame;
+    };
+
+    DatabaseAccess access;
+    std::uint64_t databaseId;
+    std::string gamesPath, indexPath;
+    std::fstream games;
+    FileLock lock;
+    //REMAPPED BY READERS FROM const LOOKUPS WHEN THE WRITER REPLACED THE FILE
+    mutable MappedFile index;
+    //OFFSET OF THE FIRST RECORD THAT IS NOT A LEGAL GAME, 0 IF THERE IS NONE
+    std::uint64_t damagedRecord;
+
+    IndexHeader &getHeader() const;
+
+    IndexSlot *getSlots() const;
+
+    bool isValidIndex() const;
+
+    //FOR A READER: REMAPS games.hxi IF THE WRITER REPLACED IT, FALSE IF NO VALID INDEX IS AVAILABLE RIGHT NOW
+    bool refreshIndex() const;
+
+    void openIndex();
+
+    //header GIVES THE COUNTERS TO KEEP, capacity AND used ARE SET HERE
+    void replaceIndex(std::uint64_t capacity, std::vector<IndexSlot> const &slots, IndexHeader header);
+
+    IndexHeader emptyHeader() const;
+
+    void growIndex();
+
+    void catchUp();
+
+    bool readRecord(std::uint64_t offset, std::vector<Move> &moves, Player &winner, std::uint64_t &next);
+
+    static bool isPlayable(std::vector<Move> const &moves, Player winner);
+
+    //ALSO ADVANCES indexedBytes TO next
+    void indexGame(std::uint64_t offset, std::uint64_t next, std::vector<Move> const &moves, Player winner);
+
+    IndexSlot const *findSlot(std::uint64_t key) const;
+
+    static std::uint64_t positionKey(Position const &position);
+};
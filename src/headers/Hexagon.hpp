@@ -5,16 +5,29 @@
 
 class Hexagon {
 public:
-    Hexagon(float x, float y, float size, sf::RenderWindow &window);
+    Hexagon(float x, float y, float size);
 
-    void draw();
+    //DRAWS THE PIECE TOO, UNLESS IT IS ANIMATED: AN ANIMATED PIECE MAY LEAVE ITS CELL AND IS DRAWN LATER WITH
+    //drawPiece(), ABOVE ALL FIELDS
+    void draw(sf::RenderTarget &target);
+
+    void drawPiece(sf::RenderTarget &target);
+
+    //MOVES, SCALES AND RECOLOURS THE PIECE UNTIL stopAnimation(). THE OWNER STAYS WHAT THE RULES SET
+    void animatePiece(Player from, Player to, float blend, float scale, sf::Vector2f center);
+
+    void stopAnimation();
 
     bool containsCoordinates(float mouseX, float mouseY) const;
 
+    sf::Vector2f getCenter() const;
+
     void setState(HexagonState state);
 
     HexagonState getState();
 
+    void setHighlighted(bool highlighted);
+
     bool belongsToEnemy(Player currentPlayer);
 
     void applyAdjacentHexagonsMode(AdjacentHexagonsMode mode, Player currentPlayer);
@@ -30,9 +43,9 @@ private:
     float x, y, size;
     Player owner;
     HexagonState currentState;
+    bool pieceAnimated;
     sf::ConvexShape shape;
     sf::CircleShape circle;
-    sf::RenderWindow &window;
 
     void setFieldColor(sf::Color color);
 
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+//SHARED MAPPING OF A WHOLE FILE. open MAPS IT READ-WRITE, CREATED OR EXTENDED WITH ZEROS TO THE REQUESTED SIZE,
+//openReadOnly MAPS AN EXISTING FILE AS IT IS. EITHER WAY THE FILE MAY BE RENAMED OVER WHILE IT IS MAPPED.
+class MappedFile {
+public:
+    MappedFile();
+
+    ~MappedFile();
+
+    MappedFile(MappedFile const &) = delete;
+
+    MappedFile &operator=(MappedFile const &) = delete;
+
+    void open(std::string const &path, std::size_t size);
+
+    //THROWS std::runtime_error IF THE FILE IS MISSING OR EMPTY
+    void openReadOnly(std::string const &path);
+
+    void close();
+
+    void flush();
+
+    unsigned char *getData() const;
+
+    std::size_t getSize() const;
+
+private:
+    unsigned char *data;
+    std::size_t size;
+#ifdef _WIN32
+    void *file, *mapping;
+#else
+    int fd;
+#endif
+};
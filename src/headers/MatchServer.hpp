@@ -0,0 +1,122 @@
+#pragma once
+
+#include "GameDatabase.hpp"
+#include "MoveHistory.hpp"
+#include "Position.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <queue>
+#include <string>
+#include <vector>
+
+//EVERY CONNECTION OWNS AT MOST MAX_LINE_LENGTH BYTES OF INPUT AND MAX_OUTPUT_SIZE BYTES OF PENDING OUTPUT.
+//A CLIENT THAT SENDS LONGER LINES OR STOPS READING IS DISCONNECTED.
+constexpr std::size_t MAX_LINE_LENGTH = 128;
+constexpr std::size_t MAX_OUTPUT_SIZE = 4096;
+
+struct ServerOptions {
+    std::string unixSocketPath;
+    std::string databasePath;
+    int port = 7610;
+    int maxConnections = 65536;
+    bool logGames = true;
+};
+
+//ONE THREAD, ONE epoll INSTANCE. CLIENTS TALK A LINE PROTOCOL:
+//  -> seek <base ms> <increment ms>      <- start <game> <A|B> <base ms> <increment ms> <save string>
+//  -> move <move>                         <- moved <move> <clock A ms> <clock B ms>   (sent to both players)
+//  -> resign | quit                       <- result <A|B|draw> <points A> <points B> <reason>
+//                                         <- error <message>
+class MatchServer {
+public:
+    MatchServer(ServerOptions const &options, std::ostream &log);
+
+    ~MatchServer();
+
+    void run();
+
+    void stop();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Connection {
+        int fd = -1;
+        std::uint32_t generation = 0;
+        std::array<char, MAX_LINE_LENGTH> input{};
+        std::size_t inputSize = 0;
+        std::string output;
+        std::size_t outputOffset = 0;
+        int game = -1;
+        bool seeking = false;
+        bool flushing = false;
+        std::pair<std::int64_t, std::int64_t> timeControl;
+    };
+
+    struct ServerGame {
+        Position position;
+        MoveHistory history;
+        std::array<int, 2> players{-1, -1};
+        std::array<std::int64_t, 2> clockMilliseconds{};
+        std::int64_t incrementMilliseconds = 0;
+        Clock::time_point turnStart;
+        std::uint64_t id = 0;
+        bool active = false;
+    };
+
+    struct Deadline {
+        Clock::time_point time;
+        int game;
+        std::uint64_t id;
+        std::uint32_t plies;
+
+        bool operator>(Deadline const &other) const { return time > other.time; }
+    };
+
+    ServerOptions options;
+    std::ostream &log;
+    int listenFd, epollFd;
+    std::atomic<bool> running;
+    std::vector<Connection> connections;
+    std::vector<int> freeConnections;
+    std::vector<ServerGame> games;
+    MoveHistoryPool histories;
+    std::unique_ptr<GameDatabase> database;
+    std::vector<int> freeGames;
+    std::map<std::pair<std::int64_t, std::int64_t>, int> seekers;
+    std::priority_queue<Deadline, std::vector<Deadline>, std::greater<>> deadlines;
+    std::uint64_t nextGameId, totalMoves, finishedGames;
+
+    void openListener();
+
+    void acceptConnections();
+
+    void readConnection(int slot);
+
+    void writeConnection(int slot);
+
+    void closeConnection(int slot);
+
+    void handleLine(int slot, std::string const &line);
+
+    void seek(int slot, std::int64_t baseMilliseconds, std::int64_t incrementMilliseconds);
+
+    void startGame(int first, int second, std::int64_t baseMilliseconds, std::int64_t incrementMilliseconds);
+
+    void playMove(int slot, std::string const &text);
+
+    void finishGame(int game, int winner, std::string const &reason);
+
+    void expireDeadlines();
+
+    int nextTimeout() const;
+
+    void send(int slot, std::string const &line);
+
+    std::uint64_t eventData(int slot) const;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Position.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr int MOVE_BLOCK_CAPACITY = 30;
+constexpr std::uint32_t NO_MOVE_BLOCK = ~std::uint32_t(0);
+
+//ONE CACHE LINE OF MOVES, CHAINED TO THE NEXT BLOCK BY INDEX
+struct MoveBlock {
+    std::array<Move, MOVE_BLOCK_CAPACITY> moves;
+    std::uint32_t next;
+};
+
+static_assert(sizeof(MoveBlock) == 64);
+
+//A HANDLE INTO A MoveHistoryPool - TRIVIALLY COPYABLE SO IT CAN SIT NEXT TO A Position IN A FLAT ARRAY
+struct MoveHistory {
+    std::uint32_t first = NO_MOVE_BLOCK;
+    std::uint32_t last = NO_MOVE_BLOCK;
+    std::uint32_t size = 0;
+};
+
+//BLOCKS ARE NEVER RETURNED TO THE HEAP, RELEASED HISTORIES GO BACK ON A FREE LIST FOR THE NEXT GAME
+class MoveHistoryPool {
+public:
+    explicit MoveHistoryPool(std::size_t reservedBlocks = 0);
+
+    void append(MoveHistory &history, Move move);
+
+    Move get(MoveHistory const &history, std::uint32_t index) const;
+
+    std::vector<Move> toVector(MoveHistory const &history) const;
+
+    std::string toString(MoveHistory const &history) const;
+
+    void release(MoveHistory &history);
+
+    std::size_t getBlockCount() const;
+
+    std::size_t getFreeBlockCount() const;
+
+private:
+    std::vector<MoveBlock> blocks;
+    std::uint32_t freeBlocks;
+    std::size_t freeBlockCount;
+
+    std::uint32_t allocate();
+};
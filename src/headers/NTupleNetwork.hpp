@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Position.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+constexpr int NTUPLE_LENGTH = 7;
+constexpr int NTUPLE_TABLE_SIZE = 2187;
+//WEIGHTS ARE STORED IN 1/NTUPLE_WEIGHT_SCALE OF AN EVALUATION POINT
+constexpr int NTUPLE_WEIGHT_SCALE = 8;
+constexpr char NTUPLE_WEIGHTS_MAGIC[] = "HXNT";
+constexpr std::uint32_t NTUPLE_WEIGHTS_VERSION = 1;
+
+//A FLOWER (CELL + ITS 6 NEIGHBOURS) AROUND EVERY CELL. FLOWERS THAT ARE IMAGES OF EACH OTHER UNDER ONE OF THE
+//BOARD SYMMETRIES SHARE A TABLE, WITH THEIR CELLS LISTED IN MATCHING ORDER. MISSING NEIGHBOURS AT THE EDGE ARE -1.
+struct NTuple {
+    std::array<int, NTUPLE_LENGTH> cells;
+    int tableOffset;
+};
+
+class NTupleNetwork {
+public:
+    NTupleNetwork();
+
+    void load(std::string const &fileName);
+
+    void save(std::string const &fileName) const;
+
+    //SIDE-TO-MOVE RELATIVE: EVERY CELL IS EMPTY (0), OWN (1) OR ENEMY (2)
+    int evaluate(Position const &position) const;
+
+    void computeIndices(Position const &position, int *indices) const;
+
+    //THE SUM OF THE WEIGHTS OF ONE POSITION TURNED INTO ITS SCORE
+    static int toEvaluation(int weightSum);
+
+    //OFFSET OF THE TUPLE'S PATTERN WITHIN ITS TABLE, CELL i COUNTS 3^i TIMES ITS STATE
+    static int tupleIndex(NTuple const &tuple, Bitboard own, Bitboard enemy);
+
+    std::vector<NTuple> const &getTuples() const;
+
+    int getTupleCount() const;
+
+    int getWeightCount() const;
+
+    std::vector<std::int16_t> const &getWeights() const;
+
+    //THE SAME WEIGHTS AS int32, WHICH THE BATCHED EVALUATION GATHERS
+    std::vector<std::int32_t> const &getWidenedWeights() const;
+
+    void setWeights(std::vector<std::int16_t> const &newWeights);
+
+private:
+    std::vector<NTuple> tuples;
+    std::vector<std::int16_t> weights;
+    std::vector<std::int32_t> widenedWeights;
+};
+
+//THE NETWORK USED BY evaluate, OR nullptr WHEN NO WEIGHTS WERE LOADED
+NTupleNetwork const *getEvaluationNetwork();
+
+//RETURNS FALSE WHEN THE FILE DOES NOT EXIST, THROWS std::runtime_error WHEN IT IS MALFORMED
+bool loadEvaluationNetwork(std::string const &fileName);
@@ -12,11 +12,13 @@ public:
 
 private:
     sf::RenderWindow &window;
-    sf::Text backToGameText, saveAndExitText, exitText;
+    sf::Text backToGameText, analysisText, saveAndExitText, exitText;
     sf::RectangleShape background;
     sf::Font font;
     Game &game;
+    bool analysisShown;
 
+    void updateAnalysisText();
     void updateTextColors();
     void updateTextColor(sf::Text &text);
 };
\ No newline at end of file
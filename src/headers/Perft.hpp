@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Position.hpp"
+#include "TaskScheduler.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+constexpr int MAX_PERFT_DEPTH = 16;
+//SUBTREES WITH 2 TO 4 PLIES LEFT ARE CACHED, SHALLOWER ONES ARE CHEAPER TO RECOUNT THAN TO LOOK UP
+constexpr int PERFT_CACHE_DEPTH = 4;
+
+//COUNTS FOR ONE PLY: THE POSITIONS REACHED AND THE KIND OF MOVE THAT REACHED THEM
+struct PerftCounts {
+    std::uint64_t nodes = 0;
+    std::uint64_t captures = 0;
+    std::uint64_t clones = 0;
+    std::uint64_t jumps = 0;
+    std::uint64_t terminals = 0;
+
+    void add(PerftCounts const &other, std::uint64_t multiplier = 1);
+};
+
+struct PerftResult {
+    int depth = 0;
+    //plies[0] IS THE ROOT
+    std::array<PerftCounts, MAX_PERFT_DEPTH + 1> plies{};
+    int splitPly = 0;
+    std::size_t taskCount = 0;
+    std::uint64_t cacheProbes = 0;
+    std::uint64_t cacheHits = 0;
+    std::int64_t microseconds = 0;
+
+    //CHILDREN PER NON-TERMINAL POSITION OF THE PREVIOUS PLY
+    double getBranchingFactor(int ply) const;
+
+    std::uint64_t getTotalNodes() const;
+
+    double getNodesPerSecond() const;
+};
+
+//POSITIONS ARE STORED IN CANONICAL ORIENTATION AND COMPARED IN FULL, SO SYMMETRIC SUBTREES ARE COUNTED ONCE AND A
+//HASH COLLISION CAN NEVER CORRUPT THE COUNTS. SHARED BY ALL WORKERS THROUGH STRIPED LOCKS.
+class PerftCache {
+public:
+    explicit PerftCache(std::size_t megabytes);
+
+    bool probe(Position const &canonical, int depth, std::array<PerftCounts, PERFT_CACHE_DEPTH> &counts);
+
+    void store(Position const &canonical, int depth, std::array<PerftCounts, PERFT_CACHE_DEPTH> const &counts);
+
+private:
+    struct Entry {
+        Position position;
+        int depth = 0;
+        std::array<PerftCounts, PERFT_CACHE_DEPTH> counts{};
+    };
+
+    static constexpr std::size_t LOCK_COUNT = 4096;
+
+    std::vector<Entry> entries;
+    std::uint64_t mask;
+    std::unique_ptr<std::mutex[]> locks;
+};
+
+//THE FIRST PLIES ARE EXPANDED ON THE CALLING THREAD UNTIL THERE ARE ENOUGH DISTINCT POSITIONS TO KEEP EVERY WORKER
+//BUSY, TRANSPOSITIONS AMONG THEM ARE MERGED, AND EVERY REMAINING SUBTREE BECOMES ONE TASK. cache MAY BE NULL.
+PerftResult perft(Position const &position, int depth, TaskScheduler &scheduler, PerftCache *cache);
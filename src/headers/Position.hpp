@@ -0,0 +1,164 @@
+#pragma once
+
+#include "Enums.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+using Bitboard = std::uint64_t;
+
+constexpr int BOARD_COLUMNS = 9;
+constexpr int CELL_COUNT = 61;
+constexpr int MAX_MOVES = 512;
+constexpr int SAVE_STRING_LENGTH = CELL_COUNT + 1;
+
+//CELLS ARE NUMBERED LIKE IN THE SAVE FILE: COLUMN BY COLUMN FROM THE LEFT, TOP TO BOTTOM INSIDE A COLUMN
+struct CellGeometry {
+    std::array<int, BOARD_COLUMNS> columnStart{};
+    std::array<int, BOARD_COLUMNS> columnSize{};
+    std::array<int, CELL_COUNT> column{};
+    std::array<int, CELL_COUNT> row{};
+    std::array<Bitboard, CELL_COUNT> neighbours{};
+    std::array<Bitboard, CELL_COUNT> jumps{};
+};
+
+constexpr CellGeometry makeCellGeometry() {
+    CellGeometry geometry;
+    int cell = 0;
+    for (int column = 0; column < BOARD_COLUMNS; column++) {
+        int distanceFromCenter = column < BOARD_COLUMNS / 2 ? BOARD_COLUMNS / 2 - column : column - BOARD_COLUMNS / 2;
+        geometry.columnStart[column] = cell;
+        geometry.columnSize[column] = BOARD_COLUMNS - distanceFromCenter;
+        for (int row = 0; row < geometry.columnSize[column]; row++) {
+            geometry.column[cell] = column;
+            geometry.row[cell] = row;
+            cell++;
+        }
+    }
+
+    //DOUBLED-HEIGHT COORDINATES: EVERY COLUMN IS SHIFTED HALF A CELL DOWN PER STEP AWAY FROM THE CENTER
+    for (int a = 0; a < CELL_COUNT; a++) {
+        for (int b = 0; b < CELL_COUNT; b++) {
+            int qa = geometry.column[a] - BOARD_COLUMNS / 2;
+            int qb = geometry.column[b] - BOARD_COLUMNS / 2;
+            int ya = (qa < 0 ? -qa : qa) + 2 * geometry.row[a];
+            int yb = (qb < 0 ? -qb : qb) + 2 * geometry.row[b];
+            int dq = qa < qb ? qb - qa : qa - qb;
+            int dy = ya < yb ? yb - ya : ya - yb;
+            int distance = dq + (dy > dq ? (dy - dq) / 2 : 0);
+
+            if (distance == 1) geometry.neighbours[a] |= Bitboard(1) << b;
+            if (distance == 2) geometry.jumps[a] |= Bitboard(1) << b;
+        }
+    }
+    return geometry;
+}
+
+inline constexpr CellGeometry CELLS = makeCellGeometry();
+
+constexpr Bitboard ALL_CELLS = (Bitboard(1) << CELL_COUNT) - 1;
+
+constexpr Bitboard cellBit(int cell) {
+    return Bitboard(1) << cell;
+}
+
+struct Move {
+    std::int8_t from = -1;
+    std::int8_t to = -1;
+
+    bool isNull() const { return to < 0; }
+
+    bool isJump() const { return (CELLS.jumps[from] & cellBit(to)) != 0; }
+
+    bool operator==(Move const &other) const = default;
+
+    //CLONES TO THE SAME CELL ARE THE SAME MOVE WHICHEVER PIECE IS CLONED
+    bool isSameAs(Move const &other) const {
+        if (to != other.to || isNull()) return to == other.to;
+        return from == other.from || (!isJump() && !other.isJump());
+    }
+
+    //CLONES ARE WRITTEN AS THE TARGET CELL ONLY ("e5"), JUMPS AS SOURCE AND TARGET ("a1c2")
+    std::string toString() const;
+};
+
+struct MoveList {
+    std::array<Move, MAX_MOVES> moves;
+    int size = 0;
+
+    Move *begin() { return moves.data(); }
+
+    Move *end() { return moves.data() + size; }
+
+    Move const *begin() const { return moves.data(); }
+
+    Move const *end() const { return moves.data() + size; }
+};
+
+//A PLAIN VALUE OF AT MOST 32 BYTES, SO LARGE NUMBERS OF GAMES CAN LIVE IN FLAT ARRAYS AND BE COPIED WITH memcpy
+class Position {
+public:
+    Position();
+
+    static Position fromString(std::string const &line);
+
+    static Position fromBitboards(Bitboard playerA, Bitboard playerB, Player sideToMove);
+
+    std::string toString() const;
+
+    Player getSideToMove() const;
+
+    Player getOwner(int cell) const;
+
+    void setOwner(int cell, Player owner);
+
+    void setSideToMove(Player player);
+
+    Bitboard getPieces(Player player) const;
+
+    Bitboard getEmpty() const;
+
+    int getPoints(Player player) const;
+
+    void generateMoves(MoveList &moveList) const;
+
+    bool hasMoves() const;
+
+    int countCaptures(Move move) const;
+
+    bool isLegal(Move move) const;
+
+    Move parseMove(std::string const &text) const;
+
+    void makeMove(Move move);
+
+    bool isGameOver() const;
+
+    int getPlyCount() const;
+
+    std::uint64_t hash() const;
+
+    //THE hash() OF THE POSITION THESE BITBOARDS WOULD MAKE, WITHOUT BUILDING IT
+    static std::uint64_t hashBitboards(Bitboard playerA, Bitboard playerB, Player sideToMove);
+
+    //THE PLY COUNTER IS HISTORY, NOT PART OF THE POSITION
+    bool operator==(Position const &other) const;
+
+private:
+    std::array<Bitboard, 2> pieces;
+    std::uint64_t key;
+    std::uint16_t plyCount;
+    Player sideToMove;
+
+    static int playerIndex(Player player);
+
+    std::uint64_t computeHash() const;
+};
+
+static_assert(sizeof(Position) <= 32);
+static_assert(std::is_trivially_copyable_v<Position>);
+
+Player opponentOf(Player player);
+
+std::string cellName(int cell);
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "Enums.hpp"
+#include "Position.hpp"
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+
+//BINARY FORMAT: "HXXB" FOLLOWED BY 16-BYTE RECORDS, TWO LITTLE-ENDIAN BITBOARDS (PLAYER A, PLAYER B).
+//BIT 63 OF THE FIRST BITBOARD IS SET WHEN PLAYER B IS TO MOVE.
+constexpr char BINARY_POSITIONS_MAGIC[] = "HXXB";
+constexpr int BINARY_POSITION_SIZE = 16;
+
+class PositionReader {
+public:
+    PositionReader(std::istream &input, PositionFormat format);
+
+    //RETURNS FALSE AT THE END OF THE INPUT, THROWS std::runtime_error WHEN A SINGLE RECORD IS MALFORMED
+    bool next(Position &position);
+
+private:
+    std::istream &input;
+    PositionFormat format;
+    std::string line;
+
+    void detectFormat();
+
+    bool nextText(Position &position);
+
+    bool nextBinary(Position &position);
+};
+
+class PositionWriter {
+public:
+    explicit PositionWriter(std::ostream &output);
+
+    void write(Position const &position);
+
+private:
+    std::ostream &output;
+};
@@ -1,6 +1,9 @@
 #pragma once
 
+#include "TaskScheduler.hpp"
 #include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
 
 class Game;
 
@@ -20,6 +23,9 @@ private:
     sf::Text savedGamesText;
     sf::Font font;
     Game &game;
+    CancellationToken scanToken;
+
+    void showSavedGames(std::vector<std::string> const &fileNames);
 
     void updateTextColors();
 
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "Evaluation.hpp"
+#include "Position.hpp"
+#include "SearchStatistics.hpp"
+#include "TranspositionTable.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class TimeManager;
+
+constexpr int MAX_MULTI_PV = 8;
+
+//THE CLOCK IS READ ONCE PER THIS MANY NODES, A POWER OF TWO SO THE TEST IS A MASK
+constexpr std::uint64_t TIME_CHECK_INTERVAL = 1024;
+
+struct SearchLimits {
+    int depth = MAX_PLY - 1;
+    std::int64_t milliseconds = 0;
+    std::uint64_t nodes = 0;
+    //OPTIONAL FLAGS OWNED BY ANOTHER THREAD: stopSignal ENDS THE SEARCH, WHILE ponderSignal IS SET THE TIME AND
+    //NODE LIMITS ARE NOT ENFORCED AND THE CLOCK STARTS WHEN IT IS CLEARED
+    std::atomic<bool> const *stopSignal = nullptr;
+    std::atomic<bool> const *ponderSignal = nullptr;
+    //OPTIONAL, STARTED BY THE CALLER: ITS MAXIMUM CAPS milliseconds AND IT DECIDES AFTER EVERY ITERATION WHETHER TO GO
+    //ON. NOT CONSULTED WHILE PONDERING.
+    TimeManager *timeManager = nullptr;
+    //THE BEST multiPv ROOT MOVES EACH GET THEIR OWN FULL-WINDOW SEARCH: THE N-TH SEARCH EXCLUDES THE N-1 MOVES FOUND
+    //BEFORE IT. MEANT FOR ANALYSIS, IT COSTS ABOUT multiPv TIMES THE NODES.
+    int multiPv = 1;
+};
+
+//FIXED CAPACITY SO THAT RETURNING A RESULT NEVER ALLOCATES
+struct PrincipalVariation {
+    std::array<Move, MAX_PLY> moves;
+    int length = 0;
+
+    std::size_t size() const { return static_cast<std::size_t>(length); }
+
+    Move const &operator[](std::size_t index) const { return moves[index]; }
+
+    Move const *begin() const { return moves.data(); }
+
+    Move const *end() const { return moves.data() + length; }
+};
+
+struct SearchLine {
+    int score = 0;
+    PrincipalVariation principalVariation;
+};
+
+struct SearchResult {
+    Move bestMove;
+    int score = 0;
+    int depth = 0;
+    std::uint64_t nodes = 0;
+    //NODES BELOW bestMove IN THE ITERATION THAT FOUND IT
+    std::uint64_t bestMoveNodes = 0;
+    PrincipalVariation principalVariation;
+    //BEST FIRST, lines[0] IS THE MAIN LINE ABOVE. FEWER THAN multiPv WHEN THERE ARE FEWER LEGAL MOVES.
+    std::array<SearchLine, MAX_MULTI_PV> lines;
+    int lineCount = 0;
+};
+
+using IterationCallback = std::function<void(SearchResult const &, SearchStatistics const &)>;
+
+class Search {
+public:
+    explicit Search(std::size_t hashMegabytes);
+
+    SearchResult run(Position const &position, SearchLimits const &searchLimits);
+
+    void stop();
+
+    SearchStatistics const &getStatistics() const;
+
+    void clearHash();
+
+    void setHashSize(std::size_t megabytes);
+
+    //CALLED ON THE SEARCHING THREAD AFTER EVERY COMPLETED ITERATION
+    void setIterationCallback(IterationCallback callback);
+
+private:
+    TranspositionTable table;
+    SearchLimits limits;
+    std::chrono::steady_clock::time_point startTime;
+    std::atomic<bool> stopped;
+    bool pondering;
+    IterationCallback iterationCallback;
+    SearchStatistics statistics;
+    int rootDepth;
+    std::uint64_t rootBestMoveNodes;
+    std::array<Move, MAX_MULTI_PV> excludedRootMoves;
+    int excludedRootMoveCount;
+    std::array<std::array<Move, MAX_PLY>, MAX_PLY> pvTable;
+    std::array<int, MAX_PLY> pvLength;
+    std::array<std::array<Move, 2>, MAX_PLY> killers;
+
+    int alphaBeta(Position const &position, int depth, int alpha, int beta, int ply);
+
+    void scoreMoves(Position const &position, MoveList const &moves, Move hashMove, int ply,
+                    std::array<int, MAX_MOVES> &scores) const;
+
+    void updatePrincipalVariation(Move move, int ply);
+
+    bool isExcludedRootMove(Move move) const;
+
+    void checkLimits();
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Evaluation.hpp"
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+struct IterationStatistics {
+    int depth = 0;
+    std::uint64_t nodes = 0;
+    std::int64_t microseconds = 0;
+};
+
+//EVERY Search OWNS ITS OWN COUNTERS, SO THREADS NEVER SHARE THEM WHILE SEARCHING. TOTALS ARE BUILT WITH merge.
+struct SearchStatistics {
+    std::uint64_t searches = 0;
+    std::uint64_t nodes = 0;
+    std::uint64_t tableProbes = 0;
+    std::uint64_t tableHits = 0;
+    std::uint64_t tableCutoffs = 0;
+    std::uint64_t betaCutoffs = 0;
+    std::uint64_t firstMoveCutoffs = 0;
+    int depth = 0;
+    int selectiveDepth = 0;
+    std::int64_t microseconds = 0;
+    std::array<IterationStatistics, MAX_PLY> iterations{};
+    int iterationCount = 0;
+
+    void reset();
+
+    void merge(SearchStatistics const &other);
+
+    double getNodesPerSecond() const;
+
+    double getEffectiveBranchingFactor() const;
+
+    double getTableHitRate() const;
+
+    double getTableCutoffRate() const;
+
+    double getFirstMoveCutoffRate() const;
+
+    std::string toJson() const;
+};
+
+//JSON LINES OUTPUT SHARED BY ALL SEARCH THREADS, ONE LINE PER FINISHED SEARCH
+class StatisticsSink {
+public:
+    StatisticsSink();
+
+    //"-" WRITES TO STDERR
+    void open(std::string const &fileName);
+
+    bool isOpen() const;
+
+    void write(SearchStatistics const &statistics);
+
+    void write(std::string const &label, SearchStatistics const &statistics);
+
+private:
+    std::ofstream file;
+    std::ostream *output;
+    std::mutex mutex;
+};
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "CellAnimator.hpp"
+#include "Position.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+
+//4 TRIANGLES FOR THE FIELD AND 4 FOR THE PIECE ON IT
+constexpr int VERTICES_PER_CELL = 24;
+
+//ALL BOARDS LIVE IN ONE VERTEX BUFFER. EVERY TILE IS THE SAME CELL TEMPLATE MOVED AND SCALED INTO ITS SLOT,
+//AND ONLY THE PIECE VERTICES OF CELLS THAT CHANGED OR ARE ANIMATED ARE REWRITTEN
+class SpectatorView {
+public:
+    SpectatorView(sf::RenderWindow &window, int boardCount);
+
+    //A BOARD THAT MOVED ONCE SINCE THE LAST UPDATE IS ANIMATED, ONE THAT SKIPPED AHEAD SNAPS TO ITS NEW POSITION
+    void update(std::vector<Position> const &positions);
+
+    void step(int steps);
+
+    //POSES THE ANIMATED PIECES AND UPLOADS EVERY CHANGED CELL, CALLED ONCE PER FRAME BEFORE draw()
+    void interpolate(double alpha);
+
+    void draw();
+
+    int getBoardCount() const;
+
+private:
+    sf::RenderWindow &window;
+    int boardCount;
+    std::vector<sf::Vertex> vertices;
+    sf::VertexBuffer buffer;
+    bool useBuffer;
+    std::vector<Position> shownPositions;
+    std::vector<CellAnimator> animators;
+    std::vector<Bitboard> animatedCells, dirtyCells;
+    std::vector<sf::Vector2f> centers;
+    float pieceRadius;
+
+    void buildGeometry();
+
+    void setPiece(int board, int cell, sf::Vector2f center, float radius, sf::Color color);
+
+    void setRestingPiece(int board, int cell);
+};
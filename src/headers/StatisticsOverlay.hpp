@@ -0,0 +1,24 @@
+#pragma once
+
+#include "SearchStatistics.hpp"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+
+class StatisticsOverlay {
+public:
+    StatisticsOverlay(sf::RenderWindow &window);
+
+    void draw();
+
+    void update(SearchStatistics const &statistics);
+
+    void updateAllocations(std::uint64_t frameAllocations, std::uint64_t moveAllocations);
+
+private:
+    sf::Font font;
+    sf::Text text;
+    sf::Text allocationText;
+    std::uint64_t shownFrameAllocations;
+    std::uint64_t shownMoveAllocations;
+    sf::RenderWindow &window;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "Position.hpp"
+#include <array>
+
+//THE BOARD IS A REGULAR HEXAGON: 6 ROTATIONS, EACH WITH AND WITHOUT A MIRROR
+constexpr int SYMMETRY_COUNT = 12;
+constexpr int BOARD_RADIUS = BOARD_COLUMNS / 2;
+
+using CellPermutation = std::array<int, CELL_COUNT>;
+
+struct CubeCoordinates {
+    int x, y, z;
+};
+
+//https://www.redblobgames.com/grids/hexagons/#coordinates-cube
+constexpr CubeCoordinates toCube(int cell) {
+    int q = CELLS.column[cell] - BOARD_RADIUS;
+    int doubledY = (q < 0 ? -q : q) + 2 * CELLS.row[cell] - 2 * BOARD_RADIUS;
+    int r = (doubledY - q) / 2;
+    return {q, -q - r, r};
+}
+
+constexpr int fromCube(CubeCoordinates cube) {
+    int q = cube.x;
+    int doubledY = 2 * cube.z + q;
+    int column = q + BOARD_RADIUS;
+    if (column < 0 || column >= BOARD_COLUMNS) return -1;
+
+    int doubledRow = doubledY + 2 * BOARD_RADIUS - (q < 0 ? -q : q);
+    if (doubledRow < 0 || doubledRow % 2 != 0 || doubledRow / 2 >= CELLS.columnSize[column]) return -1;
+    return CELLS.columnStart[column] + doubledRow / 2;
+}
+
+constexpr std::array<CubeCoordinates, 6> CUBE_DIRECTIONS = {{
+        {1, -1, 0}, {1, 0, -1}, {0, 1, -1}, {-1, 1, 0}, {-1, 0, 1}, {0, -1, 1}
+}};
+
+constexpr std::array<CellPermutation, SYMMETRY_COUNT> makeCellSymmetries() {
+    std::array<CellPermutation, SYMMETRY_COUNT> symmetries{};
+    for (int symmetry = 0; symmetry < SYMMETRY_COUNT; symmetry++) {
+        for (int cell = 0; cell < CELL_COUNT; cell++) {
+            auto cube = toCube(cell);
+            if (symmetry >= 6) {
+                cube = {cube.x, cube.z, cube.y};
+            }
+            for (int rotation = 0; rotation < symmetry % 6; rotation++) {
+                cube = {-cube.z, -cube.x, -cube.y};
+            }
+            symmetries[symmetry][cell] = fromCube(cube);
+        }
+    }
+    return symmetries;
+}
+
+inline constexpr std::array<CellPermutation, SYMMETRY_COUNT> SYMMETRIES = makeCellSymmetries();
+
+constexpr std::array<int, SYMMETRY_COUNT> makeInverseSymmetries() {
+    std::array<int, SYMMETRY_COUNT> inverses{};
+    for (int symmetry = 0; symmetry < SYMMETRY_COUNT; symmetry++) {
+        for (int candidate = 0; candidate < SYMMETRY_COUNT; candidate++) {
+            bool inverse = true;
+            for (int cell = 0; cell < CELL_COUNT; cell++) {
+                if (SYMMETRIES[candidate][SYMMETRIES[symmetry][cell]] != cell) inverse = false;
+            }
+            if (inverse) inverses[symmetry] = candidate;
+        }
+    }
+    return inverses;
+}
+
+inline constexpr std::array<int, SYMMETRY_COUNT> INVERSE_SYMMETRIES = makeInverseSymmetries();
+
+//position IS THE ORIGINAL POSITION MAPPED BY symmetry. EQUIVALENT POSITIONS SHARE THE SAME CANONICAL position.
+struct CanonicalForm {
+    Position position;
+    int symmetry;
+};
+
+//THE hash() OF THE CANONICAL POSITION, FOR TABLE LOOKUPS THAT DO NOT NEED THE POSITION ITSELF
+struct CanonicalKey {
+    std::uint64_t key;
+    int symmetry;
+};
+
+Bitboard transformBitboard(Bitboard bitboard, int symmetry);
+
+Position transformPosition(Position const &position, int symmetry);
+
+Move transformMove(Move move, int symmetry);
+
+CanonicalForm canonicalize(Position const &position);
+
+//THE SAME AS canonicalize(position).position.hash(), BUT ONLY THE WINNING IMAGE IS HASHED AND NO Position IS BUILT.
+//WHEN THE POSITION IS ITS OWN CANONICAL FORM THE INCREMENTAL hash() IS USED AS IT IS
+CanonicalKey canonicalKey(Position const &position);
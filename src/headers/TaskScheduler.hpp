@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Enums.hpp"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+constexpr int TASK_PRIORITY_COUNT = 2;
+
+//COPIES SHARE ONE FLAG. getFlag() CAN BE HANDED TO SearchLimits::stopSignal
+class CancellationToken {
+public:
+    CancellationToken();
+
+    void cancel();
+
+    bool isCancelled() const;
+
+    std::atomic<bool> const *getFlag() const;
+
+private:
+    std::shared_ptr<std::atomic<bool>> flag;
+};
+
+//EVERY WORKER OWNS A DEQUE PER PRIORITY: IT TAKES ITS OWN NEWEST TASK AND STEALS THE OLDEST TASK OF OTHER WORKERS.
+//UI_CRITICAL TASKS OF ALL WORKERS ARE TAKEN BEFORE ANY BACKGROUND TASK. CONTINUATIONS ARE QUEUED FOR THE THREAD
+//CALLING runContinuations(), WHICH IN THE GAME IS THE RENDER LOOP.
+class TaskScheduler {
+public:
+    using Task = std::function<void()>;
+
+    explicit TaskScheduler(int threadCount = 0);
+
+    //RUNS THE TASKS ALREADY SUBMITTED, THEN JOINS THE WORKERS
+    ~TaskScheduler();
+
+    TaskScheduler(TaskScheduler const &) = delete;
+
+    TaskScheduler &operator=(TaskScheduler const &) = delete;
+
+    //A TASK WHOSE TOKEN IS CANCELLED BEFORE IT STARTS IS DROPPED. AN EXCEPTION THROWN BY A TASK IS RETHROWN FROM
+    //runContinuations() ON THE MAIN THREAD
+    void submit(Task task, TaskPriority priority = TaskPriority::BACKGROUND,
+                CancellationToken token = CancellationToken());
+
+    //work() RUNS ON A WORKER, continuation(result) ON THE MAIN THREAD UNLESS THE TOKEN WAS CANCELLED IN BETWEEN
+    template<typename Work, typename Continuation>
+    void submitWithContinuation(Work work, Continuation continuation,
+                                TaskPriority priority = TaskPriority::BACKGROUND,
+                                CancellationToken token = CancellationToken()) {
+        submit([this, work = std::move(work), continuation = std::move(continuation), token]() mutable {
+            auto result = work();
+            post([continuation, token, result = std::move(result)]() mutable {
+                if (!token.isCancelled()) continuation(std::move(result));
+            });
+        }, priority, token);
+    }
+
+    void post(Task continuation);
+
+    int runContinuations();
+
+    //THE CALLING THREAD HELPS WITH QUEUED TASKS UNTIL EVERY SUBMITTED TASK HAS FINISHED
+    void wait();
+
+    int getThreadCount() const;
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::array<std::deque<std::pair<Task, CancellationToken>>, TASK_PRIORITY_COUNT> queues;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::atomic<int> queuedTasks, pendingTasks;
+    std::atomic<unsigned> nextWorker;
+    std::atomic<bool> stopping;
+    std::mutex sleepMutex;
+    std::condition_variable sleepCondition, doneCondition;
+    std::mutex continuationMutex;
+    std::vector<Task> continuations;
+
+    void workerLoop(int index);
+
+    bool takeTask(int index, std::pair<Task, CancellationToken> &entry);
+
+    void runTask(std::pair<Task, CancellationToken> &entry);
+};
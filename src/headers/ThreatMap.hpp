@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Position.hpp"
+#include <array>
+#include <cstdint>
+
+//PER-CELL CAPTURE AND THREAT COUNTS FOR BOTH PLAYERS. update() ONLY RECOMPUTES CELLS NEAR THE ONES THAT CHANGED
+class ThreatMap {
+public:
+    ThreatMap();
+
+    void update(Position const &position);
+
+    //PIECES player WOULD TAKE OVER BY MOVING INTO cell
+    int getCaptures(Player player, int cell) const;
+
+    //CHANGE OF (OWN POINTS - ENEMY POINTS) AFTER THE MOVE
+    int getScoreDelta(Move move) const;
+
+    Bitboard getTargets(int from) const;
+
+    //EMPTY CELLS player CAN MOVE INTO
+    Bitboard getReachable(Player player) const;
+
+    //ENEMY MOVES THAT WOULD TAKE OVER THE PIECE OF player ON cell
+    int getThreats(Player player, int cell) const;
+
+private:
+    std::array<Bitboard, 2> pieces;
+    Player sideToMove;
+    bool initialized;
+    std::array<Bitboard, 2> reachable;
+    std::array<std::array<std::uint8_t, CELL_COUNT>, 2> captures;
+    std::array<std::array<std::uint8_t, CELL_COUNT>, 2> threats;
+
+    static int playerIndex(Player player);
+};
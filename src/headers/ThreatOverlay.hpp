@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Hexagon.hpp"
+#include "ThreatMap.hpp"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <vector>
+
+class ThreatOverlay {
+public:
+    ThreatOverlay();
+
+    void draw(sf::RenderTarget &target, ThreatMap const &threatMap, std::vector<Hexagon> const &hexagons,
+              Player currentPlayer, int source);
+
+private:
+    sf::Font font;
+    sf::Text label;
+    //CAPTURES 0-6 AND POINT SWINGS 0-13, BUILT ONCE SO DRAWING A FRAME DOES NOT ALLOCATE
+    std::array<std::array<sf::String, 14>, 7> labels;
+    sf::CircleShape marker;
+};
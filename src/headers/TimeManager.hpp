@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Position.hpp"
+#include "Search.hpp"
+#include <cstdint>
+
+//TURNS THE CLOCK OF THE SIDE TO MOVE INTO A BUDGET FOR ONE MOVE. THE OPTIMUM IS WHAT A TYPICAL MOVE MAY USE, IT IS
+//STRETCHED WHILE THE BEST MOVE KEEPS CHANGING OR THE SCORE FALLS AND SHRUNK WHEN ONE MOVE DOMINATES THE SEARCH.
+//THE MAXIMUM IS A HARD LIMIT THAT Search CHECKS EVERY TIME_CHECK_INTERVAL NODES.
+class TimeManager {
+public:
+    TimeManager();
+
+    void start(Position const &position, std::int64_t remainingMilliseconds, std::int64_t incrementMilliseconds);
+
+    std::int64_t getOptimumMilliseconds() const;
+
+    std::int64_t getMaximumMilliseconds() const;
+
+    //CALLED BY Search AFTER EVERY COMPLETED ITERATION: TRUE WHEN ANOTHER ITERATION IS NOT WORTH STARTING
+    bool shouldStop(SearchResult const &result, std::int64_t elapsedMilliseconds);
+
+private:
+    std::int64_t optimum, maximum;
+    int legalMoves;
+    Move previousBestMove;
+    int previousScore;
+    int stableIterations;
+    double instability;
+    std::uint64_t previousNodes;
+    std::int64_t previousElapsed;
+    double previousIterationMilliseconds;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Enums.hpp"
+#include "Position.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct TranspositionEntry {
+    std::uint64_t key = 0;
+    Move move;
+    std::int16_t score = 0;
+    std::uint8_t depth = 0;
+    BoundType bound = BoundType::NONE;
+    std::uint16_t generation = 0;
+};
+
+class TranspositionTable {
+public:
+    explicit TranspositionTable(std::size_t megabytes);
+
+    void resize(std::size_t megabytes);
+
+    void clear();
+
+    //CHEAP CLEAR: ENTRIES STORED BEFORE THE CALL ARE IGNORED FROM NOW ON
+    void invalidate();
+
+    bool probe(std::uint64_t key, TranspositionEntry &entry) const;
+
+    void store(std::uint64_t key, Move move, int score, int depth, BoundType bound);
+
+private:
+    std::vector<TranspositionEntry> entries;
+    std::uint64_t mask;
+    std::uint16_t generation;
+};
@@ -1,6 +1,9 @@
 #include "headers/Game.hpp"
+#include "headers/NTupleNetwork.hpp"
 
 int main() {
+    loadEvaluationNetwork("../weights/ntuple.bin");
+
     auto window = sf::RenderWindow{{1000, 600}, "Hexxagon"};
 
     Game game(window);
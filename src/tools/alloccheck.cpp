@@ -0,0 +1,148 @@
+#include "../headers/AllocationCounter.hpp"
+#include "../headers/Board.hpp"
+#include "../headers/Evaluation.hpp"
+#include "../headers/NTupleNetwork.hpp"
+#include "../headers/Search.hpp"
+#include "../headers/ThreatMap.hpp"
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr int CHECKED_POSITIONS = 32;
+    constexpr int CHECKED_FRAMES = 120;
+    constexpr int CLOCK_WARMUP_FRAMES = 8;
+    constexpr char const *FRAME_SAVE = "Hexxagon_alloccheck";
+
+    //POSITIONS FROM RANDOM GAMES, GENERATED BEFORE ANY SCOPE IS OPENED
+    std::vector<Position> randomPositions() {
+        std::mt19937_64 random(7);
+        std::vector<Position> positions;
+        Position position;
+        while (static_cast<int>(positions.size()) < CHECKED_POSITIONS) {
+            if (isTerminal(position)) position = Position();
+            MoveList moveList;
+            position.generateMoves(moveList);
+            position.makeMove(moveList.moves[random() % moveList.size]);
+            positions.push_back(position);
+        }
+        return positions;
+    }
+
+    bool report(std::string const &name, std::uint64_t allocations) {
+        std::cout << fmt::format(R"({{"check":"{}","allocations":{}}})", name, allocations) << '\n';
+        return allocations == 0;
+    }
+
+    //A LOADED BOARD DRAWN OFFSCREEN LIKE A FRAME OF THE GAME: CLOCKS UPDATED, INTERPOLATED, WITH A MOVE ANIMATING AND
+    //THE THREAT OVERLAY SWITCHED ON HALFWAY. CLICKS ARE EVENTS, THE GAME DOES NOT COUNT THEM AS A FRAME EITHER.
+    //THE BOARD'S CLOCK BARELY MOVES DURING THE CHECK, SO A SEPARATE COUNTER IS FED A NEW SECOND OR TENTH EVERY FRAME
+    bool checkFrames(Position const &position) {
+        sf::RenderWindow window(sf::VideoMode(1000, 600), "Hexxagon alloccheck", sf::Style::None);
+        window.setVisible(false);
+        sf::RenderTexture texture;
+        if (!texture.create(window.getSize().x, window.getSize().y)) {
+            throw std::runtime_error("Unable to create the offscreen render texture.");
+        }
+
+        auto saveDirectory = std::filesystem::temp_directory_path() /
+                             fmt::format("hexxagon_alloccheck_{}", std::random_device{}());
+        std::filesystem::create_directories(saveDirectory);
+        {
+            std::ofstream file(saveDirectory / FRAME_SAVE);
+            file << position.toString();
+        }
+        Board board(9, 9, 35, window, saveDirectory);
+        board.load(FRAME_SAVE);
+        std::filesystem::remove_all(saveDirectory);
+
+        Counter counter(window, Player::PLAYER_A);
+        std::int64_t milliseconds = 11000;
+        auto frame = [&] {
+            board.updateClock();
+            //CROSSES FROM "0:11" INTO THE TENTHS AND BACK
+            milliseconds = milliseconds > 8000 ? milliseconds - 700 : 11000;
+            counter.updateClock(milliseconds, true);
+            board.step();
+            board.interpolate(0.5);
+            texture.clear();
+            board.draw(texture);
+            counter.draw(texture);
+            texture.display();
+        };
+        //ONE FULL CYCLE OF CLOCK LABELS, SO EVERY GLYPH THEY USE IS ALREADY IN THE FONT'S TEXTURE
+        for (int i = 0; i < CLOCK_WARMUP_FRAMES; i++) {
+            frame();
+        }
+        board.toggleThreats();
+        frame();
+        board.toggleThreats();
+
+        MoveList moveList;
+        position.generateMoves(moveList);
+        if (moveList.size > 0) {
+            Move move = moveList.moves[0];
+            board.onMouseClick(board.getCellCenter(move.from).x, board.getCellCenter(move.from).y);
+            board.onMouseClick(board.getCellCenter(move.to).x, board.getCellCenter(move.to).y);
+        }
+
+        AllocationScope frameScope;
+        for (int i = 0; i < CHECKED_FRAMES; i++) {
+            if (i == CHECKED_FRAMES / 2) board.toggleThreats();
+            frame();
+        }
+        return report("frame", frameScope.getAllocations());
+    }
+}
+
+//STEADY-STATE HOT PATHS MUST NOT ALLOCATE. EVERY CHECK RUNS ONCE TO WARM UP BEFORE IT IS MEASURED.
+int main(int argc, char **argv) {
+    if (!isAllocationCountingEnabled()) {
+        std::cerr << "Build with -DHEXXAGON_COUNT_ALLOCATIONS=ON to count allocations.\n";
+        return 1;
+    }
+    loadEvaluationNetwork(argc > 1 ? argv[1] : "../weights/ntuple.bin");
+
+    auto positions = randomPositions();
+    Search search(16);
+    ThreatMap threatMap;
+    bool passed = true;
+
+    SearchLimits limits;
+    limits.depth = 4;
+    search.run(positions[0], limits);
+    AllocationScope searchScope;
+    for (auto const &position: positions) {
+        search.run(position, limits);
+    }
+    passed &= report("search", searchScope.getAllocations());
+
+    AllocationScope movesScope;
+    int total = 0;
+    for (auto const &position: positions) {
+        MoveList moveList;
+        position.generateMoves(moveList);
+        for (Move move: moveList) {
+            Position child = position;
+            child.makeMove(move);
+            total += evaluate(child);
+        }
+    }
+    passed &= report("moves_and_evaluation", movesScope.getAllocations());
+
+    threatMap.update(positions[0]);
+    AllocationScope threatScope;
+    for (auto const &position: positions) {
+        threatMap.update(position);
+    }
+    passed &= report("threat_map", threatScope.getAllocations());
+
+    passed &= checkFrames(positions[CHECKED_POSITIONS / 2]);
+
+    std::cout << fmt::format(R"({{"passed":{},"checksum":{}}})", passed, total) << '\n';
+    return passed ? 0 : 1;
+}
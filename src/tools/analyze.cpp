@@ -0,0 +1,266 @@
+#include "../headers/NTupleNetwork.hpp"
+#include "../headers/PositionReader.hpp"
+#include "../headers/Search.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    struct Options {
+        SearchLimits limits;
+        std::size_t hashMegabytes = 16;
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        std::size_t window = 0;
+        PositionFormat format = PositionFormat::AUTO;
+        bool convert = false;
+        std::string inputPath = "-";
+        std::string weightsPath = "../weights/ntuple.bin";
+        std::string statisticsPath;
+    };
+
+    struct Job {
+        std::uint64_t index = 0;
+        Position position;
+        std::string error;
+        std::string output;
+        bool done = false;
+    };
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_analyze [--threads N] [--depth N] [--movetime MS] [--nodes N] [--hash MB]\n"
+                     "                        [--window N] [--format auto|text|binary] [--weights FILE] [--convert]\n"
+                     "                        [--stats FILE|-] [FILE|-]\n";
+    }
+
+    Options parseOptions(int argc, char **argv) {
+        Options options;
+        bool depthGiven = false;
+
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+                return argv[++i];
+            };
+
+            if (argument == "--threads") {
+                options.threads = std::max(1, std::stoi(value()));
+            } else if (argument == "--depth") {
+                options.limits.depth = std::stoi(value());
+                depthGiven = true;
+            } else if (argument == "--movetime") {
+                options.limits.milliseconds = std::stoll(value());
+            } else if (argument == "--nodes") {
+                options.limits.nodes = std::stoull(value());
+            } else if (argument == "--hash") {
+                options.hashMegabytes = std::stoull(value());
+            } else if (argument == "--window") {
+                options.window = std::stoull(value());
+            } else if (argument == "--format") {
+                auto format = value();
+                if (format == "auto") options.format = PositionFormat::AUTO;
+                else if (format == "text") options.format = PositionFormat::TEXT;
+                else if (format == "binary") options.format = PositionFormat::BINARY;
+                else throw std::runtime_error("Unknown format: " + format);
+            } else if (argument == "--weights") {
+                options.weightsPath = value();
+            } else if (argument == "--stats") {
+                options.statisticsPath = value();
+            } else if (argument == "--convert") {
+                options.convert = true;
+            } else if (!argument.empty() && argument[0] == '-' && argument != "-") {
+                throw std::runtime_error("Unknown option: " + argument);
+            } else {
+                options.inputPath = argument;
+            }
+        }
+
+        //WITHOUT ANY BUDGET EVERY POSITION GETS THE SAME FIXED DEPTH
+        if (!depthGiven && options.limits.milliseconds == 0 && options.limits.nodes == 0) {
+            options.limits.depth = 6;
+        }
+        if (options.window == 0) {
+            options.window = 4 * options.threads;
+        }
+        return options;
+    }
+
+    std::string escapeJson(std::string const &text) {
+        std::string escaped;
+        for (char c: text) {
+            if (c == '"' || c == '\\') escaped += '\\';
+            if (static_cast<unsigned char>(c) < 0x20) continue;
+            escaped += c;
+        }
+        return escaped;
+    }
+
+    void formatResult(Job &job, SearchResult const &result) {
+        job.output = fmt::format(R"({{"index":{},"bestmove":{},"score":{},"depth":{},"nodes":{},"pv":[)",
+                                 job.index,
+                                 result.bestMove.isNull() ? "null" : "\"" + result.bestMove.toString() + "\"",
+                                 result.score, result.depth, result.nodes);
+        for (std::size_t i = 0; i < result.principalVariation.size(); i++) {
+            if (i > 0) job.output += ',';
+            job.output += '"' + result.principalVariation[i].toString() + '"';
+        }
+        job.output += "]}";
+    }
+
+    //POSITIONS ARE READ, ANALYSED AND WRITTEN THROUGH A RING OF window SLOTS: THE READER NEVER GETS MORE THAN
+    //window POSITIONS AHEAD OF THE WRITER, SO MEMORY USE DOES NOT DEPEND ON THE SIZE OF THE INPUT
+    class AnalysisPipeline {
+    public:
+        explicit AnalysisPipeline(Options const &options) : options(options), jobs(options.window),
+                                                            totals(options.threads) {
+            if (!options.statisticsPath.empty()) {
+                statisticsSink.open(options.statisticsPath);
+            }
+        }
+
+        void run(PositionReader &reader, std::ostream &output) {
+            std::vector<std::thread> workers;
+            for (unsigned i = 0; i < options.threads; i++) {
+                workers.emplace_back([this, i]() { work(totals[i]); });
+            }
+
+            bool inputLeft = true;
+            while (inputLeft) {
+                Job job;
+                try {
+                    inputLeft = reader.next(job.position);
+                } catch (std::runtime_error const &error) {
+                    job.error = error.what();
+                }
+                if (!inputLeft) break;
+
+                std::unique_lock lock(mutex);
+                if (submitted - written == jobs.size()) {
+                    flushOldest(lock, output);
+                }
+                job.index = submitted;
+                jobs[submitted % jobs.size()] = std::move(job);
+                submitted++;
+                workAvailable.notify_one();
+            }
+
+            std::unique_lock lock(mutex);
+            while (written < submitted) {
+                flushOldest(lock, output);
+            }
+            finished = true;
+            workAvailable.notify_all();
+            lock.unlock();
+
+            for (auto &worker: workers) {
+                worker.join();
+            }
+
+            SearchStatistics summary;
+            for (auto const &workerTotals: totals) {
+                summary.merge(workerTotals);
+            }
+            statisticsSink.write("summary", summary);
+        }
+
+    private:
+        Options const &options;
+        std::vector<Job> jobs;
+        std::uint64_t submitted = 0, taken = 0, written = 0;
+        bool finished = false;
+        std::mutex mutex;
+        std::condition_variable workAvailable, workDone;
+        std::vector<SearchStatistics> totals;
+        StatisticsSink statisticsSink;
+
+        void flushOldest(std::unique_lock<std::mutex> &lock, std::ostream &output) {
+            auto &job = jobs[written % jobs.size()];
+            workDone.wait(lock, [&]() { return job.done; });
+            output << job.output << '\n';
+            written++;
+        }
+
+        void work(SearchStatistics &workerTotals) {
+            Search search(options.hashMegabytes);
+
+            std::unique_lock lock(mutex);
+            while (true) {
+                workAvailable.wait(lock, [&]() { return finished || taken < submitted; });
+                if (taken == submitted) return;
+
+                auto &job = jobs[taken % jobs.size()];
+                taken++;
+                lock.unlock();
+
+                if (job.error.empty()) {
+                    search.clearHash();
+                    formatResult(job, search.run(job.position, options.limits));
+                    workerTotals.merge(search.getStatistics());
+                    statisticsSink.write(search.getStatistics());
+                } else {
+                    job.output = fmt::format(R"({{"index":{},"error":"{}"}})", job.index, escapeJson(job.error));
+                }
+
+                lock.lock();
+                job.done = true;
+                workDone.notify_one();
+            }
+        }
+    };
+
+    void convert(PositionReader &reader, std::ostream &output) {
+        PositionWriter writer(output);
+        Position position;
+        std::uint64_t index = 0;
+
+        while (true) {
+            try {
+                if (!reader.next(position)) break;
+                writer.write(position);
+            } catch (std::runtime_error const &error) {
+                std::cerr << "Skipping position " << index << ": " << error.what() << '\n';
+            }
+            index++;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    try {
+        auto options = parseOptions(argc, argv);
+        if (!loadEvaluationNetwork(options.weightsPath)) {
+            std::cerr << "No n-tuple weights at " << options.weightsPath << ", using the feature evaluation\n";
+        }
+
+        std::ifstream file;
+        if (options.inputPath != "-") {
+            file.open(options.inputPath, std::ios::binary);
+            if (!file.is_open()) {
+                throw std::runtime_error("Unable to open " + options.inputPath);
+            }
+        }
+        std::istream &input = options.inputPath == "-" ? std::cin : file;
+        std::ios::sync_with_stdio(false);
+
+        PositionReader reader(input, options.format);
+        if (options.convert) {
+            convert(reader, std::cout);
+        } else {
+            AnalysisPipeline pipeline(options);
+            pipeline.run(reader, std::cout);
+        }
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
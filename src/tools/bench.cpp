@@ -0,0 +1,335 @@
+#include "../headers/Board.hpp"
+#include "../headers/Evaluation.hpp"
+#include "../headers/NTupleNetwork.hpp"
+#include "../headers/Search.hpp"
+#include "../headers/TaskScheduler.hpp"
+#include "../headers/ThreatMap.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr int SAMPLE_POSITIONS = 256;
+    constexpr int SEARCH_POSITIONS = 8;
+    constexpr char const *BENCH_SAVE = "Hexxagon_bench";
+
+    struct Options {
+        int samples = 15;
+        int searchDepth = 5;
+        std::string filter;
+        bool render = true;
+        std::string weightsPath = "../weights/ntuple.bin";
+    };
+
+    struct Summary {
+        std::string name;
+        std::string unit;
+        std::uint64_t iterations = 0;
+        std::vector<double> values;
+    };
+
+    //EVERY BENCHMARK FEEDS ITS RESULTS IN HERE, SO THE COMPILER CANNOT DROP THE MEASURED WORK
+    std::uint64_t checksum = 0;
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_bench [--samples N] [--depth N] [--filter TEXT] [--no-render] [--weights FILE]\n";
+    }
+
+    Options parseOptions(int argc, char **argv) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+                return argv[++i];
+            };
+
+            if (argument == "--samples") {
+                options.samples = std::max(1, std::stoi(value()));
+            } else if (argument == "--depth") {
+                options.searchDepth = std::max(1, std::stoi(value()));
+            } else if (argument == "--filter") {
+                options.filter = value();
+            } else if (argument == "--no-render") {
+                options.render = false;
+            } else if (argument == "--weights") {
+                options.weightsPath = value();
+            } else {
+                throw std::runtime_error("Unknown option: " + argument);
+            }
+        }
+        return options;
+    }
+
+    //POSITIONS FROM RANDOM GAMES WITH A FIXED SEED, SO EVERY RUN MEASURES THE SAME WORK
+    std::vector<Position> samplePositions(int count) {
+        std::mt19937_64 random(20240611);
+        std::vector<Position> positions;
+        Position position;
+        while (static_cast<int>(positions.size()) < count) {
+            if (isTerminal(position)) position = Position();
+            MoveList moveList;
+            position.generateMoves(moveList);
+            position.makeMove(moveList.moves[random() % moveList.size]);
+            positions.push_back(position);
+        }
+        return positions;
+    }
+
+    //body() RUNS iterations OPERATIONS. ONE UNTIMED WARM-UP, THEN ONE NANOSECONDS-PER-OPERATION VALUE PER SAMPLE
+    template<typename Body>
+    Summary measure(std::string const &name, std::uint64_t iterations, int samples, Body body) {
+        Summary summary{name, "ns", iterations, {}};
+        body();
+        for (int sample = 0; sample < samples; sample++) {
+            auto start = std::chrono::steady_clock::now();
+            body();
+            auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            summary.values.push_back(elapsed / static_cast<double>(iterations));
+        }
+        return summary;
+    }
+
+    std::string toJson(Summary const &summary) {
+        auto values = summary.values;
+        std::sort(values.begin(), values.end());
+        double mean = 0;
+        for (double value: values) mean += value;
+        mean /= static_cast<double>(values.size());
+        double variance = 0;
+        for (double value: values) variance += (value - mean) * (value - mean);
+        variance /= values.size() > 1 ? static_cast<double>(values.size() - 1) : 1.0;
+        auto percentile = [&](double fraction) {
+            return values[static_cast<std::size_t>(std::lround(fraction * static_cast<double>(values.size() - 1)))];
+        };
+
+        return fmt::format(R"({{"name":"{}","unit":"{}","iterations":{},"samples":{},"min":{:.3f},"median":{:.3f},)"
+                           R"("mean":{:.3f},"stddev":{:.3f},"p90":{:.3f},"max":{:.3f}}})", summary.name, summary.unit,
+                           summary.iterations, values.size(), values.front(), percentile(0.5), mean,
+                           std::sqrt(variance), percentile(0.9), values.back());
+    }
+
+    class BenchmarkSuite {
+    public:
+        explicit BenchmarkSuite(Options const &options) : options(options),
+                                                          positions(samplePositions(SAMPLE_POSITIONS)) {}
+
+        bool isSelected(std::string const &name) const {
+            return options.filter.empty() || name.find(options.filter) != std::string::npos;
+        }
+
+        void add(Summary summary) {
+            results.push_back(std::move(summary));
+        }
+
+        void runRules() {
+            auto count = static_cast<std::uint64_t>(positions.size());
+            if (isSelected("move_generation")) {
+                add(measure("move_generation", count * 100, options.samples, [&] {
+                    MoveList moveList;
+                    for (int repeat = 0; repeat < 100; repeat++) {
+                        for (auto const &position: positions) {
+                            position.generateMoves(moveList);
+                            checksum += moveList.size;
+                        }
+                    }
+                }));
+            }
+
+            //Position IS COPY-MAKE: THE UNMAKE IS DROPPING THE COPY, SO THIS IS THE COST OF ONE MOVE INCLUDING IT
+            MoveList allMoves;
+            std::vector<std::pair<Position, Move>> moves;
+            for (auto const &position: positions) {
+                position.generateMoves(allMoves);
+                for (Move move: allMoves) moves.emplace_back(position, move);
+            }
+            if (isSelected("make_move")) {
+                add(measure("make_move", moves.size() * 10, options.samples, [&] {
+                    for (int repeat = 0; repeat < 10; repeat++) {
+                        for (auto const &[position, move]: moves) {
+                            Position child = position;
+                            child.makeMove(move);
+                            checksum += child.hash();
+                        }
+                    }
+                }));
+            }
+            if (isSelected("capture_resolution")) {
+                add(measure("capture_resolution", moves.size() * 10, options.samples, [&] {
+                    for (int repeat = 0; repeat < 10; repeat++) {
+                        for (auto const &[position, move]: moves) {
+                            checksum += position.countCaptures(move);
+                        }
+                    }
+                }));
+            }
+            if (isSelected("threat_map_update")) {
+                ThreatMap threatMap;
+                add(measure("threat_map_update", count * 10, options.samples, [&] {
+                    for (int repeat = 0; repeat < 10; repeat++) {
+                        for (auto const &position: positions) {
+                            threatMap.update(position);
+                            checksum += threatMap.getReachable(position.getSideToMove());
+                        }
+                    }
+                }));
+            }
+        }
+
+        void runEngine() {
+            auto count = static_cast<std::uint64_t>(positions.size());
+            if (isSelected("evaluation")) {
+                add(measure("evaluation", count * 100, options.samples, [&] {
+                    for (int repeat = 0; repeat < 100; repeat++) {
+                        for (auto const &position: positions) {
+                            checksum += static_cast<std::uint64_t>(evaluate(position));
+                        }
+                    }
+                }));
+            }
+            if (isSelected("evaluation_batch")) {
+                std::vector<int> scores(positions.size());
+                //EVERY KERNEL THE CPU SUPPORTS MUST AGREE WITH evaluate BEFORE THE FASTEST ONE IS TIMED
+                auto fastest = getEvaluationKernel();
+                for (int kernel = 0; kernel <= static_cast<int>(fastest); kernel++) {
+                    setEvaluationKernel(static_cast<EvaluationKernel>(kernel));
+                    evaluateBatch(positions.data(), static_cast<int>(positions.size()), scores.data());
+                    for (std::size_t i = 0; i < positions.size(); i++) {
+                        if (scores[i] != evaluate(positions[i])) {
+                            throw std::runtime_error(fmt::format("Evaluation kernel {} disagrees with evaluate.",
+                                                                 kernel));
+                        }
+                    }
+                }
+                add(measure("evaluation_batch", count * 100, options.samples, [&] {
+                    for (int repeat = 0; repeat < 100; repeat++) {
+                        evaluateBatch(positions.data(), static_cast<int>(positions.size()), scores.data());
+                        checksum += static_cast<std::uint64_t>(scores[repeat % scores.size()]);
+                    }
+                }));
+            }
+
+            //A CLEARED TABLE BEFORE EVERY SEARCH, SO EVERY SAMPLE SEARCHES THE SAME TREE
+            if (isSelected("search_nodes")) {
+                Search search(16);
+                SearchLimits limits;
+                limits.depth = options.searchDepth;
+                Summary summary{"search_nodes", "nodes_per_second", SEARCH_POSITIONS, {}};
+                for (int sample = 0; sample <= options.samples; sample++) {
+                    std::uint64_t nodes = 0;
+                    auto start = std::chrono::steady_clock::now();
+                    for (int i = 0; i < SEARCH_POSITIONS; i++) {
+                        search.clearHash();
+                        auto result = search.run(positions[i * SAMPLE_POSITIONS / SEARCH_POSITIONS], limits);
+                        nodes += search.getStatistics().nodes;
+                        checksum += static_cast<std::uint64_t>(result.score);
+                    }
+                    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                    //THE FIRST ROUND ONLY WARMS UP
+                    if (sample > 0) summary.values.push_back(static_cast<double>(nodes) / seconds);
+                }
+                add(std::move(summary));
+            }
+        }
+
+        //THE BENCHMARK BOARD SAVES INTO ITS OWN TEMPORARY DIRECTORY, NEVER INTO THE PLAYER'S SAVED GAMES
+        void runBoard() {
+            if (!options.render) return;
+            bool saveSelected = isSelected("board_save_load");
+            bool drawSelected = isSelected("board_draw");
+            if (!saveSelected && !drawSelected) return;
+
+            //THE GAME'S WINDOW SIZE, SO THE BOARD GEOMETRY IS THE ONE PLAYERS SEE
+            sf::RenderWindow window(sf::VideoMode(1000, 600), "Hexxagon bench", sf::Style::None);
+            window.setVisible(false);
+            sf::RenderTexture texture;
+            if (!texture.create(window.getSize().x, window.getSize().y)) {
+                throw std::runtime_error("Unable to create the offscreen render texture.");
+            }
+
+            auto saveDirectory = std::filesystem::temp_directory_path() /
+                                 fmt::format("hexxagon_bench_{}", std::random_device{}());
+            std::filesystem::create_directories(saveDirectory);
+            {
+                std::ofstream file(saveDirectory / BENCH_SAVE);
+                file << positions[SAMPLE_POSITIONS / 2].toString();
+            }
+            Board board(9, 9, 35, window, saveDirectory);
+            board.load(BENCH_SAVE);
+
+            if (saveSelected) {
+                TaskScheduler scheduler(1);
+                //SAVE, WAIT FOR THE WORKER TO WRITE THE FILE, LOAD IT BACK AND DELETE IT
+                add(measure("board_save_load", 20, options.samples, [&] {
+                    for (int repeat = 0; repeat < 20; repeat++) {
+                        auto fileName = board.save(scheduler);
+                        scheduler.wait();
+                        board.load(fileName);
+                    }
+                    checksum += board.getPosition().hash();
+                }));
+            }
+            std::filesystem::remove_all(saveDirectory);
+
+            if (drawSelected) {
+                //display() RESOLVES THE FRAME INTO THE TEXTURE, SO THE DRIVER CANNOT DEFER ALL OF THE WORK
+                auto frames = [&](char const *name) {
+                    add(measure(name, 100, options.samples, [&] {
+                        for (int repeat = 0; repeat < 100; repeat++) {
+                            texture.clear();
+                            board.draw(texture);
+                            texture.display();
+                        }
+                    }));
+                };
+                frames("board_draw");
+                board.toggleThreats();
+                frames("board_draw_threats");
+                board.toggleThreats();
+            }
+        }
+
+        void print() const {
+            std::string benchmarks;
+            for (auto const &summary: results) {
+                if (!benchmarks.empty()) benchmarks += ',';
+                benchmarks += toJson(summary);
+            }
+            std::cout << fmt::format(R"({{"benchmarks":[{}],"search_depth":{},"network":{},"checksum":{}}})",
+                                     benchmarks, options.searchDepth, getEvaluationNetwork() != nullptr,
+                                     checksum) << '\n';
+        }
+
+    private:
+        Options options;
+        std::vector<Position> positions;
+        std::vector<Summary> results;
+    };
+}
+
+int main(int argc, char **argv) {
+    try {
+        auto options = parseOptions(argc, argv);
+        loadEvaluationNetwork(options.weightsPath);
+
+        BenchmarkSuite suite(options);
+        suite.runRules();
+        suite.runEngine();
+        suite.runBoard();
+        suite.print();
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
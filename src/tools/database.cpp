@@ -0,0 +1,112 @@
+#include "../headers/GameDatabase.hpp"
+#include <chrono>
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_db [--database DIR] import FILE...   (game lines of a hexxagon_server log)\n"
+                     "       hexxagon_db [--database DIR] query [SAVE_STRING|startpos] [MOVES...]\n";
+    }
+
+    std::string jsonField(std::string const &line, std::string const &name) {
+        auto start = line.find("\"" + name + "\":\"");
+        if (start == std::string::npos) return "";
+        start += name.size() + 4;
+        return line.substr(start, line.find('"', start) - start);
+    }
+
+    void importLog(GameDatabase &database, std::string const &path) {
+        std::ifstream file(path);
+        if (!file.is_open()) throw std::runtime_error("Unable to open " + path);
+
+        std::string line;
+        long imported = 0, skipped = 0;
+        while (std::getline(file, line)) {
+            if (line.find(R"("event":"game")") == std::string::npos) continue;
+
+            std::string result = jsonField(line, "result");
+            Player winner = result == "A" ? Player::PLAYER_A : result == "B" ? Player::PLAYER_B : Player::NO_PLAYER;
+            std::istringstream moveStream(jsonField(line, "moves"));
+            std::vector<Move> moves;
+            Position position;
+            try {
+                for (std::string text; moveStream >> text;) {
+                    Move move = position.parseMove(text);
+                    position.makeMove(move);
+                    moves.push_back(move);
+                }
+                database.addGame(moves, winner);
+                imported++;
+            } catch (std::runtime_error const &) {
+                skipped++;
+            }
+        }
+        std::cout << fmt::format(R"({{"file":"{}","imported":{},"skipped":{},"games":{}}})", path, imported, skipped,
+                                 database.getGameCount()) << '\n';
+    }
+
+    void query(GameDatabase &database, int argc, char **argv, int first) {
+        Position position;
+        if (first < argc && std::string(argv[first]) != "startpos") {
+            position = Position::fromString(argv[first]);
+        }
+        for (int i = first + 1; i < argc; i++) {
+            position.makeMove(position.parseMove(argv[i]));
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        PositionStatistics statistics;
+        database.lookup(position, statistics);
+        auto continuations = database.getContinuations(position);
+        auto microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+        std::string moves;
+        for (auto const &continuation: continuations) {
+            if (!moves.empty()) moves += ',';
+            moves += fmt::format(R"({{"move":"{}","games":{},"wins":{},"draws":{},"losses":{}}})",
+                                 continuation.move.toString(), continuation.statistics.games,
+                                 continuation.statistics.wins, continuation.statistics.getDraws(),
+                                 continuation.statistics.losses);
+        }
+        std::cout << fmt::format(R"({{"games":{},"wins":{},"draws":{},"losses":{},"win_rate":{:.3f},"last_game":{},)"
+                                 R"("last_ply":{},"continuations":[{}],"microseconds":{:.1f}}})",
+                                 statistics.games, statistics.wins, statistics.getDraws(), statistics.losses,
+                                 statistics.getWinRate(), statistics.lastGame, statistics.lastPly, moves,
+                                 microseconds) << '\n';
+    }
+}
+
+int main(int argc, char **argv) {
+    try {
+        std::string directory = "../database";
+        int i = 1;
+        if (i + 1 < argc && std::string(argv[i]) == "--database") {
+            directory = argv[i + 1];
+            i += 2;
+        }
+        if (i >= argc) throw std::runtime_error("Missing command.");
+
+        //QUERIES DO NOT NEED THE WRITER'S LOCK, SO THEY WORK WHILE A SERVER IS RECORDING INTO THE DATABASE
+        std::string command = argv[i];
+        GameDatabase database(directory, command == "query" ? DatabaseAccess::READ_ONLY : DatabaseAccess::READ_WRITE);
+        if (command == "import") {
+            for (i++; i < argc; i++) {
+                importLog(database, argv[i]);
+            }
+        } else if (command == "query") {
+            query(database, argc, argv, i + 1);
+        } else {
+            throw std::runtime_error("Unknown command: " + command);
+        }
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
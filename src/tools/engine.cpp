@@ -0,0 +1,17 @@
+#include "../headers/EngineProtocol.hpp"
+#include "../headers/NTupleNetwork.hpp"
+#include <iostream>
+
+int main(int argc, char **argv) {
+    std::string weightsPath = argc > 1 ? argv[1] : "../weights/ntuple.bin";
+
+    try {
+        loadEvaluationNetwork(weightsPath);
+    } catch (std::exception const &error) {
+        std::cout << "info string " << error.what() << std::endl;
+    }
+
+    EngineProtocol protocol(std::cin, std::cout);
+    protocol.run();
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "../headers/DifferentialHarness.hpp"
+#include <bit>
+#include <chrono>
+#include <fmt/format.h>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    struct Options {
+        std::uint64_t games = 10000;
+        std::uint64_t seed = 1;
+        double noise = 0.2;
+    };
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_fuzz [--games N] [--seed N] [--noise FRACTION]\n"
+                     "       --noise is the share of clicks on random cells instead of legal moves\n";
+    }
+
+    Options parseOptions(int argc, char **argv) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+                return argv[++i];
+            };
+
+            if (argument == "--games") {
+                options.games = std::stoull(value());
+            } else if (argument == "--seed") {
+                options.seed = std::stoull(value());
+            } else if (argument == "--noise") {
+                options.noise = std::stod(value());
+            } else {
+                throw std::runtime_error("Unknown option: " + argument);
+            }
+        }
+        return options;
+    }
+}
+
+//RANDOM MODE: EVERY GAME HAS ITS OWN SEED, SO A REPORTED FAILURE IS REPLAYED WITH --seed SEED --games 1
+int main(int argc, char **argv) {
+    Options options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+
+    //Board ANNOUNCES EVERY WINNER ON std::cout
+    std::cout.setstate(std::ios::badbit);
+    sf::RenderWindow window;
+    DifferentialHarness harness(window);
+    std::uniform_real_distribution<double> chance(0, 1);
+
+    auto start = std::chrono::steady_clock::now();
+    std::uint64_t game = 0;
+    std::string failure;
+    for (; game < options.games && failure.empty(); game++) {
+        std::mt19937_64 random(options.seed + game);
+        try {
+            harness.startGame();
+            while (!harness.isGameOver()) {
+                if (chance(random) < options.noise) {
+                    harness.click(static_cast<int>(random() % 64));
+                    continue;
+                }
+                MoveList moveList;
+                harness.getPosition().generateMoves(moveList);
+                Move move = moveList.moves[random() % moveList.size];
+                //A JUMP IS CLICKED FROM ITS SOURCE, A CLONE FROM ANY PIECE NEXT TO THE TARGET
+                if (!move.isJump()) {
+                    Bitboard sources = CELLS.neighbours[move.to] &
+                                       harness.getPosition().getPieces(harness.getPosition().getSideToMove());
+                    int count = std::popcount(sources);
+                    for (int skip = static_cast<int>(random() % count); skip > 0; skip--) {
+                        sources &= sources - 1;
+                    }
+                    move.from = static_cast<std::int8_t>(std::countr_zero(sources));
+                }
+                harness.playMove(move);
+            }
+        } catch (std::runtime_error const &error) {
+            failure = fmt::format("seed {}: {}", options.seed + game, error.what());
+        }
+    }
+    auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout.clear();
+    std::cout << fmt::format(R"({{"games":{},"moves":{},"clicks":{},"seconds":{:.3f},"clicks_per_second":{:.0f},)"
+                             R"("passed":{}}})", game, harness.getMoveCount(), harness.getClickCount(), seconds,
+                             static_cast<double>(harness.getClickCount()) / seconds, failure.empty()) << '\n';
+    if (!failure.empty()) {
+        std::cerr << failure << '\n';
+        return 1;
+    }
+    return 0;
+}
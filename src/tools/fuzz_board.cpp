@@ -0,0 +1,23 @@
+#include "../headers/DifferentialHarness.hpp"
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+
+//libFuzzer ENTRY POINT, BUILT WITH -DHEXXAGON_LIBFUZZER=ON AND CLANG. RUN FROM THE BUILD DIRECTORY LIKE THE GAME,
+//THE BOARD LOADS ITS FONTS FROM ../fonts
+extern "C" int LLVMFuzzerTestOneInput(std::uint8_t const *data, std::size_t size) {
+    static sf::RenderWindow window;
+    static auto harness = [] {
+        std::cout.setstate(std::ios::badbit);
+        return std::make_unique<DifferentialHarness>(window);
+    }();
+
+    try {
+        harness->startGame();
+        harness->playBytes(data, size);
+    } catch (std::runtime_error const &error) {
+        std::cerr << error.what() << '\n';
+        std::abort();
+    }
+    return 0;
+}
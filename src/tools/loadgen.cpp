@@ -0,0 +1,247 @@
+#include "../headers/Evaluation.hpp"
+#include "../headers/MatchServer.hpp"
+#include <arpa/inet.h>
+#include <fmt/format.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Options {
+        std::string unixSocketPath;
+        int port = 7610;
+        int connections = 1000;
+        double seconds = 10.0;
+        std::int64_t baseMilliseconds = 60000;
+        std::int64_t incrementMilliseconds = 0;
+        std::uint64_t seed = 1;
+    };
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_loadgen [--port N | --unix PATH] [--connections N] [--seconds S]\n"
+                     "                        [--base MS] [--increment MS] [--seed S]\n";
+    }
+
+    Options parseOptions(int argc, char **argv) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+            std::string value = argv[++i];
+
+            if (argument == "--port") options.port = std::stoi(value);
+            else if (argument == "--unix") options.unixSocketPath = value;
+            else if (argument == "--connections") options.connections = std::stoi(value);
+            else if (argument == "--seconds") options.seconds = std::stod(value);
+            else if (argument == "--base") options.baseMilliseconds = std::stoll(value);
+            else if (argument == "--increment") options.incrementMilliseconds = std::stoll(value);
+            else if (argument == "--seed") options.seed = std::stoull(value);
+            else throw std::runtime_error("Unknown option: " + argument);
+        }
+        return options;
+    }
+
+    int connectToServer(Options const &options) {
+        int fd;
+        int result;
+        if (!options.unixSocketPath.empty()) {
+            sockaddr_un address{};
+            address.sun_family = AF_UNIX;
+            std::strncpy(address.sun_path, options.unixSocketPath.c_str(), sizeof(address.sun_path) - 1);
+            fd = socket(AF_UNIX, SOCK_STREAM, 0);
+            result = fd < 0 ? -1 : connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+        } else {
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_port = htons(static_cast<std::uint16_t>(options.port));
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            fd = socket(AF_INET, SOCK_STREAM, 0);
+            result = fd < 0 ? -1 : connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address));
+            int enable = 1;
+            if (result == 0) setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+        }
+        if (result < 0) {
+            throw std::runtime_error(std::string("Cannot connect: ") + std::strerror(errno));
+        }
+        return fd;
+    }
+
+    //EVERY CLIENT IS A RANDOM MOVER THAT KEEPS ITS OWN COPY OF THE GAME TO PICK LEGAL MOVES
+    struct Client {
+        int fd = -1;
+        std::string input;
+        Position position;
+        Player side = Player::NO_PLAYER;
+        Clock::time_point moveSent;
+        bool waitingForEcho = false;
+    };
+
+    class LoadGenerator {
+    public:
+        explicit LoadGenerator(Options const &options) : options(options), random(options.seed) {
+            epollFd = epoll_create1(0);
+            if (epollFd < 0) throw std::runtime_error(std::string("epoll_create1: ") + std::strerror(errno));
+
+            clients.resize(options.connections);
+            for (std::size_t i = 0; i < clients.size(); i++) {
+                clients[i].fd = connectToServer(options);
+                epoll_event event{};
+                event.events = EPOLLIN;
+                event.data.u64 = i;
+                epoll_ctl(epollFd, EPOLL_CTL_ADD, clients[i].fd, &event);
+            }
+        }
+
+        ~LoadGenerator() {
+            for (auto &client: clients) {
+                if (client.fd >= 0) close(client.fd);
+            }
+            close(epollFd);
+        }
+
+        void run() {
+            std::vector<epoll_event> events(256);
+            auto start = Clock::now();
+            auto end = start +
+                       std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(options.seconds));
+
+            while (Clock::now() < end) {
+                int count = epoll_wait(epollFd, events.data(), static_cast<int>(events.size()), 100);
+                for (int i = 0; i < count; i++) {
+                    readClient(static_cast<std::size_t>(events[i].data.u64));
+                }
+            }
+
+            double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            std::cout << fmt::format(R"({{"connections":{},"seconds":{:.2f},"games":{},"moves":{},)"
+                                     R"("moves_per_second":{:.0f},"latency_average_us":{:.1f},"latency_max_us":{},)"
+                                     R"("wins_a":{},"wins_b":{},"draws":{},)"
+                                     R"("time_losses":{},"errors":{}}})",
+                                     clients.size(), seconds, games, moves, static_cast<double>(moves) / seconds,
+                                     moves ? static_cast<double>(latencyTotal) / static_cast<double>(moves) : 0.0,
+                                     latencyMaximum, winsA, winsB, draws, timeLosses, errors) << std::endl;
+        }
+
+    private:
+        Options options;
+        int epollFd;
+        std::vector<Client> clients;
+        std::mt19937_64 random;
+        std::uint64_t games = 0, moves = 0, winsA = 0, winsB = 0, draws = 0, timeLosses = 0, errors = 0;
+        std::int64_t latencyTotal = 0, latencyMaximum = 0;
+
+        void readClient(std::size_t index) {
+            Client &client = clients[index];
+            char buffer[MAX_OUTPUT_SIZE];
+            ssize_t received = recv(client.fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (received <= 0) {
+                if (received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+                throw std::runtime_error("Server closed the connection.");
+            }
+            client.input.append(buffer, static_cast<std::size_t>(received));
+
+            std::size_t lineStart = 0;
+            for (std::size_t newline; (newline = client.input.find('\n', lineStart)) != std::string::npos;) {
+                handleLine(client, client.input.substr(lineStart, newline - lineStart));
+                lineStart = newline + 1;
+            }
+            client.input.erase(0, lineStart);
+        }
+
+        void handleLine(Client &client, std::string const &line) {
+            std::istringstream stream(line);
+            std::string command;
+            stream >> command;
+
+            if (command == "hello") {
+                seek(client);
+            } else if (command == "start") {
+                std::string id, side, base, increment, position;
+                stream >> id >> side >> base >> increment >> position;
+                client.side = side == "A" ? Player::PLAYER_A : Player::PLAYER_B;
+                client.position = Position::fromString(position);
+                playIfOnTurn(client);
+            } else if (command == "moved") {
+                std::string move;
+                stream >> move;
+                if (client.waitingForEcho) {
+                    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                            Clock::now() - client.moveSent).count();
+                    latencyTotal += latency;
+                    latencyMaximum = std::max(latencyMaximum, static_cast<std::int64_t>(latency));
+                    client.waitingForEcho = false;
+                    moves++;
+                }
+                client.position.makeMove(client.position.parseMove(move));
+                playIfOnTurn(client);
+            } else if (command == "result") {
+                std::string result, pointsA, pointsB, reason;
+                stream >> result >> pointsA >> pointsB >> reason;
+                //BOTH PLAYERS GET THE RESULT, COUNT IT ONCE
+                if (client.side == Player::PLAYER_A) {
+                    games++;
+                    if (result == "A") winsA++;
+                    else if (result == "B") winsB++;
+                    else draws++;
+                    if (reason == "time") timeLosses++;
+                }
+                client.side = Player::NO_PLAYER;
+                client.waitingForEcho = false;
+                seek(client);
+            } else if (command == "error") {
+                errors++;
+            }
+        }
+
+        void seek(Client &client) {
+            send(client, fmt::format("seek {} {}", options.baseMilliseconds, options.incrementMilliseconds));
+        }
+
+        void playIfOnTurn(Client &client) {
+            if (client.position.getSideToMove() != client.side || isTerminal(client.position)) return;
+
+            MoveList moveList;
+            client.position.generateMoves(moveList);
+            Move move = moveList.moves[std::uniform_int_distribution<int>(0, moveList.size - 1)(random)];
+            client.moveSent = Clock::now();
+            client.waitingForEcho = true;
+            send(client, "move " + move.toString());
+        }
+
+        void send(Client &client, std::string const &line) {
+            std::string message = line + '\n';
+            auto sent = ::send(client.fd, message.data(), message.size(), MSG_NOSIGNAL);
+            if (sent != static_cast<ssize_t>(message.size())) {
+                errors++;
+            }
+        }
+    };
+}
+
+int main(int argc, char **argv) {
+    try {
+        auto options = parseOptions(argc, argv);
+        LoadGenerator generator(options);
+        generator.run();
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
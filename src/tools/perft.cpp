@@ -0,0 +1,110 @@
+#include "../headers/Perft.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+    struct Options {
+        int depth = 6;
+        int threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        std::size_t cacheMegabytes = 256;
+        std::string position = "startpos";
+        bool json = false;
+    };
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_perft [--depth N] [--threads N] [--cache MB] [--position startpos|SAVE]\n"
+                     "                      [--json]\n"
+                     "       --cache 0 counts every subtree without the cache\n";
+    }
+
+    Options parseOptions(int argc, char **argv) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+                return argv[++i];
+            };
+
+            if (argument == "--depth") {
+                options.depth = std::stoi(value());
+            } else if (argument == "--threads") {
+                options.threads = std::max(1, std::stoi(value()));
+            } else if (argument == "--cache") {
+                options.cacheMegabytes = std::stoull(value());
+            } else if (argument == "--position") {
+                options.position = value();
+            } else if (argument == "--json") {
+                options.json = true;
+            } else {
+                throw std::runtime_error("Unknown option: " + argument);
+            }
+        }
+        return options;
+    }
+
+    void printTable(PerftResult const &result) {
+        std::cout << fmt::format("{:>3} {:>16} {:>15} {:>16} {:>16} {:>13} {:>8}\n", "ply", "nodes", "captures",
+                                 "clones", "jumps", "terminals", "branch");
+        for (int ply = 0; ply <= result.depth; ply++) {
+            auto const &counts = result.plies[ply];
+            std::cout << fmt::format("{:>3} {:>16} {:>15} {:>16} {:>16} {:>13} {:>8.2f}\n", ply, counts.nodes,
+                                     counts.captures, counts.clones, counts.jumps, counts.terminals,
+                                     result.getBranchingFactor(ply));
+        }
+        double hitRate = result.cacheProbes == 0 ? 0 : 100.0 * static_cast<double>(result.cacheHits) /
+                                                       static_cast<double>(result.cacheProbes);
+        std::cout << fmt::format("\n{} nodes in {:.3f} s, {:.1f} Mnps, split at ply {} into {} tasks, "
+                                 "cache hits {:.1f}%\n", result.getTotalNodes(), result.microseconds / 1e6,
+                                 result.getNodesPerSecond() / 1e6, result.splitPly, result.taskCount, hitRate);
+    }
+
+    void printJson(PerftResult const &result, int threads) {
+        std::string plies;
+        for (int ply = 0; ply <= result.depth; ply++) {
+            auto const &counts = result.plies[ply];
+            if (!plies.empty()) plies += ',';
+            plies += fmt::format(R"({{"ply":{},"nodes":{},"captures":{},"clones":{},"jumps":{},"terminals":{},)"
+                                 R"("branching_factor":{:.4f}}})", ply, counts.nodes, counts.captures, counts.clones,
+                                 counts.jumps, counts.terminals, result.getBranchingFactor(ply));
+        }
+        std::cout << fmt::format(R"({{"depth":{},"threads":{},"plies":[{}],"total_nodes":{},"microseconds":{},)"
+                                 R"("split_ply":{},"tasks":{},"cache_probes":{},"cache_hits":{}}})", result.depth,
+                                 threads, plies, result.getTotalNodes(), result.microseconds, result.splitPly,
+                                 result.taskCount, result.cacheProbes, result.cacheHits) << '\n';
+    }
+}
+
+int main(int argc, char **argv) {
+    try {
+        auto options = parseOptions(argc, argv);
+        //THE SAME START POSITION Board::start SETS UP
+        Position position;
+        if (options.position != "startpos") {
+            position = Position::fromString(options.position);
+        }
+
+        std::unique_ptr<PerftCache> cache;
+        if (options.cacheMegabytes > 0) {
+            cache = std::make_unique<PerftCache>(options.cacheMegabytes);
+        }
+        TaskScheduler scheduler(options.threads);
+        auto result = perft(position, options.depth, scheduler, cache.get());
+
+        if (options.json) {
+            printJson(result, options.threads);
+        } else {
+            printTable(result);
+        }
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include "../headers/MatchServer.hpp"
+#include <csignal>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    MatchServer *runningServer = nullptr;
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_server [--port N | --unix PATH] [--max-connections N] [--database DIR]\n"
+                     "                       [--quiet]\n";
+    }
+
+    ServerOptions parseOptions(int argc, char **argv) {
+        ServerOptions options;
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            if (argument == "--quiet") {
+                options.logGames = false;
+                continue;
+            }
+            if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+            std::string value = argv[++i];
+
+            if (argument == "--port") options.port = std::stoi(value);
+            else if (argument == "--unix") options.unixSocketPath = value;
+            else if (argument == "--database") options.databasePath = value;
+            else if (argument == "--max-connections") options.maxConnections = std::stoi(value);
+            else throw std::runtime_error("Unknown option: " + argument);
+        }
+        return options;
+    }
+
+    void handleSignal(int) {
+        if (runningServer) runningServer->stop();
+    }
+}
+
+int main(int argc, char **argv) {
+    try {
+        auto options = parseOptions(argc, argv);
+        MatchServer server(options, std::cout);
+
+        runningServer = &server;
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+        std::signal(SIGPIPE, SIG_IGN);
+
+        std::cerr << "listening on " << (options.unixSocketPath.empty()
+                                         ? "127.0.0.1:" + std::to_string(options.port)
+                                         : options.unixSocketPath) << std::endl;
+        server.run();
+        runningServer = nullptr;
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include "../headers/Evaluation.hpp"
+#include "../headers/FixedTimestep.hpp"
+#include "../headers/NTupleNetwork.hpp"
+#include "../headers/SpectatorView.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    struct Options {
+        int boards = 64;
+        double movesPerSecond = 4.0;
+        double speed = 1.0;
+        std::string weightsPath = "../weights/ntuple.bin";
+    };
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_spectator [--boards N] [--rate MOVES_PER_SECOND] [--speed FACTOR]\n"
+                     "                          [--weights FILE]\n"
+                     "       --speed plays the games and their animations FACTOR times faster\n";
+    }
+
+    Options parseOptions(int argc, char **argv) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+            std::string value = argv[++i];
+
+            if (argument == "--boards") options.boards = std::stoi(value);
+            else if (argument == "--rate") options.movesPerSecond = std::stod(value);
+            else if (argument == "--speed") options.speed = std::stod(value);
+            else if (argument == "--weights") options.weightsPath = value;
+            else throw std::runtime_error("Unknown option: " + argument);
+        }
+        if (options.boards <= 0 || options.movesPerSecond <= 0 || options.speed <= 0) {
+            throw std::runtime_error("Invalid option value.");
+        }
+        return options;
+    }
+
+    //SELF-PLAY GAMES ON A BACKGROUND THREAD. THE WINDOW ONLY COPIES THE LATEST SNAPSHOT OF 32-BYTE POSITIONS
+    class SelfPlayFeed {
+    public:
+        SelfPlayFeed(int boards, double movesPerSecond) : positions(boards), snapshot(boards), version(0),
+                                                          running(true), random(std::random_device{}()),
+                                                          movesPerSecond(movesPerSecond) {
+            worker = std::thread([this] { play(); });
+        }
+
+        ~SelfPlayFeed() {
+            running = false;
+            worker.join();
+        }
+
+        bool poll(std::vector<Position> &positions, std::uint64_t &seenVersion) {
+            std::lock_guard lock(mutex);
+            if (version == seenVersion) return false;
+            positions = snapshot;
+            seenVersion = version;
+            return true;
+        }
+
+    private:
+        std::vector<Position> positions, snapshot;
+        std::uint64_t version;
+        std::atomic<bool> running;
+        std::mutex mutex;
+        std::mt19937_64 random;
+        double movesPerSecond;
+        //BUFFERS OF chooseMove, KEPT HERE SO EVERY MOVE DOES NOT CONSTRUCT MAX_MOVES POSITIONS
+        std::array<Position, MAX_MOVES> children;
+        std::array<int, MAX_MOVES> scores;
+        std::thread worker;
+
+        void play() {
+            auto interval = std::chrono::duration<double>(1.0 / movesPerSecond);
+            auto next = std::chrono::steady_clock::now();
+
+            while (running) {
+                for (auto &position: positions) {
+                    if (isTerminal(position)) position = Position();
+                    else position.makeMove(chooseMove(position));
+                }
+                {
+                    std::lock_guard lock(mutex);
+                    snapshot = positions;
+                    version++;
+                }
+                next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval);
+                std::this_thread::sleep_until(next);
+            }
+        }
+
+        //GREEDY 1-PLY WITH SOME RANDOM MOVES SO THE BOARDS DO NOT ALL PLAY THE SAME GAME
+        Move chooseMove(Position const &position) {
+            MoveList moveList;
+            position.generateMoves(moveList);
+            if (std::uniform_real_distribution<double>(0, 1)(random) < 0.2) {
+                return moveList.moves[std::uniform_int_distribution<int>(0, moveList.size - 1)(random)];
+            }
+
+            //EVERY CHILD IS SCORED, SO THEY GO THROUGH THE BATCH API AND ITS SIMD KERNELS
+            for (int i = 0; i < moveList.size; i++) {
+                children[i] = position;
+                children[i].makeMove(moveList.moves[i]);
+            }
+            evaluateBatch(children.data(), moveList.size, scores.data());
+
+            Move best = moveList.moves[0];
+            int bestScore = -WIN_SCORE - 1;
+            for (int i = 0; i < moveList.size; i++) {
+                int score = isTerminal(children[i]) ? -terminalScore(children[i], 1) : -scores[i];
+                if (score > bestScore) {
+                    bestScore = score;
+                    best = moveList.moves[i];
+                }
+            }
+            return best;
+        }
+    };
+}
+
+int main(int argc, char **argv) {
+    try {
+        auto options = parseOptions(argc, argv);
+        loadEvaluationNetwork(options.weightsPath);
+
+        auto window = sf::RenderWindow{{1280, 960}, "Hexxagon spectator"};
+        window.setFramerateLimit(60);
+
+        SpectatorView view(window, options.boards);
+        SelfPlayFeed feed(options.boards, options.movesPerSecond * options.speed);
+        FixedTimestep timestep;
+        timestep.setTimeScale(options.speed);
+        std::vector<Position> positions;
+        std::uint64_t version = 0;
+
+        sf::Clock clock;
+        int frames = 0;
+        while (window.isOpen()) {
+            sf::Event event;
+            while (window.pollEvent(event)) {
+                if (event.type == sf::Event::Closed ||
+                    (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)) {
+                    window.close();
+                }
+            }
+
+            //AT ANY SPEED ONE CALL ADVANCES ALL ANIMATIONS, HOWEVER MANY STEPS THE FRAME TOOK
+            view.step(timestep.advance());
+            if (feed.poll(positions, version)) {
+                view.update(positions);
+            }
+            view.interpolate(timestep.getAlpha());
+            view.draw();
+            window.display();
+
+            frames++;
+            if (clock.getElapsedTime().asSeconds() >= 1.0f) {
+                window.setTitle("Hexxagon spectator - " + std::to_string(frames) + " fps");
+                frames = 0;
+                clock.restart();
+            }
+        }
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}
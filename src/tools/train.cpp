@@ -0,0 +1,187 @@
+#include "../headers/Evaluation.hpp"
+#include "../headers/NTupleNetwork.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr int MAX_GAME_LENGTH = 400;
+
+    struct Options {
+        long games = 100000;
+        float alpha = 0.05f;
+        float lambda = 0.7f;
+        float epsilon = 0.1f;
+        std::uint64_t seed = 1;
+        std::string inputPath;
+        //REQUIRED, SO A BARE RUN CANNOT OVERWRITE THE SHIPPED ../weights/ntuple.bin
+        std::string outputPath;
+    };
+
+    void printUsage() {
+        std::cerr << "Usage: hexxagon_train [--games N] [--alpha A] [--lambda L] [--epsilon E] [--seed S]\n"
+                     "                      [--input FILE] --output FILE\n";
+    }
+
+    Options parseOptions(int argc, char **argv) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            std::string argument = argv[i];
+            if (i + 1 >= argc) throw std::runtime_error("Missing value for " + argument);
+            std::string value = argv[++i];
+
+            if (argument == "--games") options.games = std::stol(value);
+            else if (argument == "--alpha") options.alpha = std::stof(value);
+            else if (argument == "--lambda") options.lambda = std::stof(value);
+            else if (argument == "--epsilon") options.epsilon = std::stof(value);
+            else if (argument == "--seed") options.seed = std::stoull(value);
+            else if (argument == "--input") options.inputPath = value;
+            else if (argument == "--output") options.outputPath = value;
+            else throw std::runtime_error("Unknown option: " + argument);
+        }
+        if (options.outputPath.empty()) throw std::runtime_error("Missing --output.");
+        return options;
+    }
+
+    //TRAINING RUNS ON FLOAT WEIGHTS, THE NETWORK ONLY EVER SEES THE QUANTIZED COPY
+    class Trainer {
+    public:
+        Trainer(Options const &options, NTupleNetwork &network) : options(options), network(network),
+                                                                  weights(network.getWeightCount(), 0.0f),
+                                                                  indices(network.getTupleCount()),
+                                                                  random(options.seed) {}
+
+        void start(std::vector<std::int16_t> const &initialWeights) {
+            for (std::size_t i = 0; i < weights.size(); i++) {
+                weights[i] = static_cast<float>(initialWeights[i]) / NTUPLE_WEIGHT_SCALE;
+            }
+        }
+
+        float playGame() {
+            std::vector<Position> history;
+            Position position;
+
+            while (!isTerminal(position) && history.size() < MAX_GAME_LENGTH) {
+                history.push_back(position);
+                position.makeMove(chooseMove(position));
+            }
+            history.push_back(position);
+
+            return learn(history);
+        }
+
+        std::vector<std::int16_t> quantize() const {
+            std::vector<std::int16_t> quantized(weights.size());
+            for (std::size_t i = 0; i < weights.size(); i++) {
+                long weight = std::lround(weights[i] * NTUPLE_WEIGHT_SCALE);
+                quantized[i] = static_cast<std::int16_t>(std::clamp(weight, -32768L, 32767L));
+            }
+            return quantized;
+        }
+
+    private:
+        Options const &options;
+        NTupleNetwork &network;
+        std::vector<float> weights;
+        std::vector<int> indices;
+        std::mt19937_64 random;
+
+        float value(Position const &position) {
+            if (isTerminal(position)) {
+                return static_cast<float>(MATERIAL_WEIGHT * finalPointsDifference(position));
+            }
+            network.computeIndices(position, indices.data());
+            float sum = 0.0f;
+            for (int index: indices) {
+                sum += weights[index];
+            }
+            return sum;
+        }
+
+        Move chooseMove(Position const &position) {
+            MoveList moves;
+            position.generateMoves(moves);
+
+            if (std::uniform_real_distribution<float>(0.0f, 1.0f)(random) < options.epsilon) {
+                return moves.moves[random() % moves.size];
+            }
+
+            Move bestMove = moves.moves[0];
+            float bestValue = -1e9f;
+            for (auto move: moves) {
+                Position child = position;
+                child.makeMove(move);
+                float childValue = -value(child);
+                if (childValue > bestValue) {
+                    bestValue = childValue;
+                    bestMove = move;
+                }
+            }
+            return bestMove;
+        }
+
+        //OFFLINE TD(LAMBDA): LAMBDA-RETURNS ARE BUILT BACKWARDS FROM THE FINAL POSITION, NEGATED AT EVERY PLY
+        //BECAUSE VALUES ARE RELATIVE TO THE SIDE TO MOVE
+        float learn(std::vector<Position> const &history) {
+            float nextValue = value(history.back());
+            float lambdaReturn = nextValue;
+            float totalError = 0.0f;
+            float rate = options.alpha / static_cast<float>(indices.size());
+
+            for (int t = static_cast<int>(history.size()) - 2; t >= 0; t--) {
+                lambdaReturn = -((1.0f - options.lambda) * nextValue + options.lambda * lambdaReturn);
+                nextValue = value(history[t]);
+
+                float error = lambdaReturn - nextValue;
+                for (int index: indices) {
+                    weights[index] += rate * error;
+                }
+                totalError += std::abs(error);
+            }
+            return totalError / static_cast<float>(std::max<std::size_t>(1, history.size() - 1));
+        }
+    };
+}
+
+int main(int argc, char **argv) {
+    try {
+        auto options = parseOptions(argc, argv);
+        NTupleNetwork network;
+        if (!options.inputPath.empty()) {
+            network.load(options.inputPath);
+        }
+
+        Trainer trainer(options, network);
+        trainer.start(network.getWeights());
+
+        float averageError = 0.0f;
+        long reportedGames = 0;
+        for (long game = 1; game <= options.games; game++) {
+            averageError += trainer.playGame();
+            if (game % 1000 == 0 || game == options.games) {
+                //THE LAST BATCH IS SHORT WHEN games IS NOT A MULTIPLE OF 1000
+                std::cout << "games " << game << " average error "
+                          << averageError / static_cast<float>(game - reportedGames) << std::endl;
+                averageError = 0.0f;
+                reportedGames = game;
+                network.setWeights(trainer.quantize());
+                std::filesystem::path output(options.outputPath);
+                if (output.has_parent_path()) {
+                    std::filesystem::create_directories(output.parent_path());
+                }
+                network.save(options.outputPath);
+            }
+        }
+    } catch (std::exception const &error) {
+        std::cerr << error.what() << '\n';
+        printUsage();
+        return 1;
+    }
+    return 0;
+}